@@ -0,0 +1,130 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "tcmalloc.h"
+
+/*
+前端缓存命中时一对malloc/free的耗时和L1D未命中数，ThreadCache和per-cpu缓存各测一遍。
+free用free_sized，不查PageMap，只统计前端缓存本身访问的cache line。
+perf_event_open不可用时(容器、perf_event_paranoid)只输出耗时。
+每个场景测kRepeats次取中位数，单次结果在共享的机器上波动很大。
+*/
+
+static int OpenL1DMisses() {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_L1D |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static const int kRounds = 20000;
+
+struct Result {
+    double ns;
+    long long misses;
+};
+
+// 每轮在nsizes个class上各分配depth个对象再全部释放，
+// nsizes越大，一轮访问的freelist越多，布局的影响越明显
+static Result RunOnce(int fd, const size_t* sizes, int nsizes, int depth) {
+    void* ptrs[64][16];
+    for (int warm = 0; warm < 2; ++warm) {
+        for (int s = 0; s < nsizes; ++s) {
+            for (int d = 0; d < depth; ++d) ptrs[d][s] = tcmalloc::malloc(sizes[s]);
+            for (int d = 0; d < depth; ++d) tcmalloc::free_sized(ptrs[d][s], sizes[s]);
+        }
+    }
+
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    auto begin = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        for (int d = 0; d < depth; ++d) {
+            for (int s = 0; s < nsizes; ++s) {
+                ptrs[d][s] = tcmalloc::malloc(sizes[s]);
+            }
+        }
+        for (int d = 0; d < depth; ++d) {
+            for (int s = 0; s < nsizes; ++s) {
+                tcmalloc::free_sized(ptrs[d][s], sizes[s]);
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    long long misses = -1;
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) {
+            misses = -1;
+        }
+    }
+
+    Result result;
+    result.ns = std::chrono::duration<double, std::nano>(end - begin).count();
+    result.misses = misses;
+    return result;
+}
+
+static void Run(int fd, const char* name, const size_t* sizes, int nsizes, int depth) {
+    const int kRepeats = 5;
+    Result results[kRepeats];
+    for (int i = 0; i < kRepeats; ++i) {
+        results[i] = RunOnce(fd, sizes, nsizes, depth);
+    }
+    std::sort(results, results + kRepeats, [](const Result& a, const Result& b) {
+        return a.ns < b.ns;
+    });
+    const Result& median = results[kRepeats / 2];
+
+    double pairs = (double)kRounds * depth * nsizes;
+    if (median.misses >= 0) {
+        printf("%-24s %8.2f ns/pair %8.3f L1D misses/pair\n", name, median.ns / pairs, median.misses / pairs);
+    } else {
+        printf("%-24s %8.2f ns/pair %8s L1D misses/pair\n", name, median.ns / pairs, "n/a");
+    }
+}
+
+int main() {
+    int fd = OpenL1DMisses();
+    if (fd < 0) {
+        printf("perf_event_open failed, only timing is reported\n");
+    }
+
+    static const size_t one[] = {32};
+    static const size_t eight[] = {8, 32, 64, 128, 256, 512, 1024, 2048};
+    static const size_t sixteen[] = {8, 16, 32, 48, 64, 96, 128, 192,
+                                     256, 384, 512, 768, 1024, 1536, 2048, 4096};
+    // 先测ThreadCache，再打开per-cpu缓存测一遍。
+    // 设置GLIBC_TUNABLES=glibc.pthread.rseq=0时per-cpu缓存退回到加锁
+    for (int per_cpu = 0; per_cpu < 2; ++per_cpu) {
+        tcmalloc::set_per_cpu_caches(per_cpu == 1);
+        printf("%s\n", per_cpu == 1 ? "per-cpu cache:" : "thread cache:");
+        Run(fd, "1 class x 64", one, 1, 64);
+        Run(fd, "8 classes x 8", eight, 8, 8);
+        Run(fd, "16 classes x 4", sixteen, 16, 4);
+        Run(fd, "16 classes x 1", sixteen, 16, 1);
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    return 0;
+}
@@ -75,6 +75,102 @@ int main() {
     memset(large_ptr, 1, 50*1024*1024);
     tcmalloc::free(large_ptr);
 
+    for (int size = 0; size <= 300*1024; size += 97) {
+        void* ptr = tcmalloc::malloc(size);
+        memset(ptr, 1, size);
+        tcmalloc::free_sized(ptr, size);
+    }
+    tcmalloc::free_sized(nullptr, 8);
+
+    for (size_t align = 1; align <= 1024*1024; align *= 2) {
+        for (int size = 0; size <= 300*1024; size += 997) {
+            void* ptr = tcmalloc::memalign(align, size);
+            assert((uintptr_t)ptr % align == 0);
+            memset(ptr, 1, size);
+            tcmalloc::free_aligned_sized(ptr, align, size);
+        }
+    }
+
+    char* buf = (char*)tcmalloc::realloc(nullptr, 300*1024);
+    memset(buf, 2, 300*1024);
+    for (size_t size = 512*1024; size <= 64*1024*1024; size *= 2) {
+        buf = (char*)tcmalloc::realloc(buf, size);
+        assert(buf[0] == 2 && buf[300*1024-1] == 2);
+    }
+    buf = (char*)tcmalloc::realloc(buf, 100);
+    assert(buf[0] == 2 && buf[99] == 2);
+    assert(tcmalloc::usable_size(buf) == 112);
+    buf = (char*)tcmalloc::realloc(buf, 0);
+    assert(buf == nullptr);
+
+    for (size_t size = 1; size <= 8*1024*1024; size = size * 3 + 1) {
+        char* zeros = (char*)tcmalloc::calloc(size, 1);
+        for (size_t i = 0; i < size; i += 4096) {
+            assert(zeros[i] == 0);
+        }
+        assert(zeros[size-1] == 0);
+        memset(zeros, 3, size);
+        tcmalloc::free(zeros);
+    }
+
+    void* batch[1000];
+    for (int size = 0; size <= 300*1024; size += 4999) {
+        size_t got = tcmalloc::malloc_batch(size, 1000, batch);
+        assert(got == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            memset(batch[i], 1, size);
+        }
+        tcmalloc::free_batch(batch, 1000);
+    }
+
+    // 数量超过一次从中心缓存取的上限时分多次取，per-cpu缓存打开时也返回实际分配的个数
+    std::vector<void*> many(200000);
+    for (bool per_cpu : {false, true}) {
+        tcmalloc::set_per_cpu_caches(per_cpu);
+        size_t got = tcmalloc::malloc_batch(16, many.size(), many.data());
+        assert(got == many.size());
+        std::set<void*> uniq(many.begin(), many.end());
+        assert(uniq.size() == many.size() && uniq.count(nullptr) == 0);
+        tcmalloc::free_batch(many.data(), many.size());
+    }
+    tcmalloc::set_per_cpu_caches(false);
+
+    for (size_t size = 0; size <= 300*1024; size += 333) {
+        size_t capacity;
+        void* ptr = tcmalloc::malloc_with_capacity(size, &capacity);
+        assert(capacity >= size);
+        assert(capacity == tcmalloc::good_size(size));
+        assert(capacity == tcmalloc::usable_size(ptr));
+        memset(ptr, 1, capacity);
+        tcmalloc::free(ptr);
+    }
+    assert(tcmalloc::good_size(100) == 112);
+
+    struct Point {
+        Point(int x, int y) : x_(x), y_(y) {}
+        int x_;
+        int y_;
+    };
+    struct alignas(64) Line {
+        Point a{0, 0};
+        Point b{1, 1};
+    };
+    for (int i = 0; i < 10000; ++i) {
+        Point* p = tcmalloc::New<Point>(i, i + 1);
+        assert(p->x_ == i && p->y_ == i + 1);
+        assert(tcmalloc::usable_size(p) == 8);
+        Line* l = tcmalloc::New<Line>();
+        assert((uintptr_t)l % 64 == 0 && l->b.y_ == 1);
+        void* fixed = tcmalloc::malloc<100>();
+        assert(tcmalloc::usable_size(fixed) == 112);
+        void* large = tcmalloc::malloc<300*1024>();
+        memset(large, 1, 300*1024);
+        tcmalloc::free(large);
+        tcmalloc::free_sized(fixed, 100);
+        tcmalloc::Delete(l);
+        tcmalloc::Delete(p);
+    }
+
     List list;
     for (int size = 0; size <= 5*1024; size++) {
         list.PushFront(tcmalloc::malloc(size));
@@ -86,5 +182,99 @@ int main() {
     }
     assert(list.Empty());
 
+    tcmalloc::set_per_cpu_caches(true);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([]() {
+            List list;
+            for (int size = 0; size <= 5*1024; size++) {
+                list.PushFront(tcmalloc::malloc(size));
+            }
+            for (int size = 5*1024; size >= 0; size--) {
+                void* ptr = list.PopFront();
+                memset(ptr, 1, size);
+                tcmalloc::free(ptr);
+            }
+            assert(tcmalloc::current_used_size() == 0);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    assert(tcmalloc::per_cpu_caches_used_size() > 0);
+    tcmalloc::set_per_cpu_caches(false);
+
+    // 主线程空闲一段时间后，后台线程把它缓存的对象还回去
+    tcmalloc::free(tcmalloc::malloc(64));
+    assert(tcmalloc::current_used_size() > 0);
+    bool started = tcmalloc::start_background_thread(1);
+    assert(started);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // 内联快路径时断时续，后台线程在停下的间隙代为归还
+    std::thread bursty([]() {
+        std::vector<void*> ptrs(32);
+        for (int round = 0; round < 200; ++round) {
+            for (auto& ptr : ptrs) {
+                ptr = tcmalloc::malloc<64>();
+                memset(ptr, round & 0xff, 64);
+            }
+            for (auto ptr : ptrs) {
+                assert(*static_cast<unsigned char*>(ptr) == (round & 0xff));
+                tcmalloc::free(ptr);
+            }
+            if (round % 4 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+        }
+    });
+    bursty.join();
+    tcmalloc::stop_background_thread();
+    void* idle = tcmalloc::malloc(64);
+    tcmalloc::free(idle);
+
+    // 一个线程分配，另一个线程释放
+    tcmalloc::set_remote_free(true);
+    std::thread producer([]() {
+        for (int round = 0; round < 10; ++round) {
+            std::vector<void*> ptrs;
+            for (int i = 0; i < 10000; ++i) {
+                ptrs.push_back(tcmalloc::malloc((i % 512) + 1));
+            }
+            std::thread consumer([&ptrs]() {
+                for (int i = 0; i < ptrs.size(); ++i) {
+                    memset(ptrs[i], 1, (i % 512) + 1);
+                    tcmalloc::free(ptrs[i]);
+                }
+            });
+            consumer.join();
+        }
+    });
+    producer.join();
+    tcmalloc::set_remote_free(false);
+
+    // 大页模式下大块内存从2MB边界开始
+    tcmalloc::set_hugepage_aware(true);
+    std::vector<void*> huge;
+    for (int i = 0; i < 8; ++i) {
+        size_t size = (i + 2) * 1024 * 1024 + i * 4096;
+        void* p = tcmalloc::malloc(size);
+        assert(p != nullptr && (uintptr_t)p % (2 * 1024 * 1024) == 0);
+        memset(p, 1, size);
+        huge.push_back(p);
+        huge.push_back(tcmalloc::malloc(100 * 1024));
+    }
+    for (void* p : huge) {
+        tcmalloc::free(p);
+    }
+    tcmalloc::set_hugepage_aware(false);
+
+    // 按页取整会回绕的大小分配失败
+    volatile size_t max_size = SIZE_MAX;
+    assert(tcmalloc::malloc(max_size) == nullptr);
+    assert(tcmalloc::memalign(4096, max_size) == nullptr);
+    assert(tcmalloc::good_size(max_size) == max_size);
+    size_t capacity = 1;
+    assert(tcmalloc::malloc_with_capacity(max_size - 100, &capacity) == nullptr && capacity == 0);
+
     printf("Everything is OK!\n");
 }
@@ -0,0 +1,100 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#include <cassert>
+#include <cstring>
+#include <cstdlib>
+#include <malloc.h>
+#include <bits/stdc++.h>
+#include "tcmalloc.h"
+
+// 链接libtcmalloc.so之后，libc的malloc系列函数和operator new/delete都由tcmalloc提供
+int main() {
+    // 100字节落在112字节的class，glibc不会返回这个大小
+    void* ptr = malloc(100);
+    assert(malloc_usable_size(ptr) == 112);
+    assert(tcmalloc::usable_size(ptr) == 112);
+    free(ptr);
+    free(nullptr);
+
+    int* zeros = (int*)calloc(1024, sizeof(int));
+    for (int i = 0; i < 1024; ++i) {
+        assert(zeros[i] == 0);
+    }
+    volatile size_t huge = SIZE_MAX;
+    assert(calloc(huge, 2) == nullptr);
+    free(zeros);
+
+    // 接近SIZE_MAX的大小按页取整会回绕，必须失败而不是返回很小的内存
+    for (size_t size : {(size_t)SIZE_MAX, (size_t)SIZE_MAX - 1, (size_t)SIZE_MAX - 8191}) {
+        volatile size_t big = size;
+        errno = 0;
+        assert(malloc(big) == nullptr && errno == ENOMEM);
+        errno = 0;
+        assert(memalign(64 * 1024, big) == nullptr && errno == ENOMEM);
+        assert(posix_memalign(&ptr, 64 * 1024, big) == ENOMEM);
+        void* small = malloc(16);
+        assert(realloc(small, big) == nullptr);
+        free(small);
+        bool thrown = false;
+        try {
+            char* p = new char[big];
+            delete[] p;
+        } catch (const std::bad_alloc&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(operator new(big, std::nothrow) == nullptr);
+    }
+
+    char* str = (char*)malloc(16);
+    strcpy(str, "tcmalloc");
+    for (size_t size = 32; size <= 8 * 1024 * 1024; size *= 2) {
+        str = (char*)realloc(str, size);
+        assert(strcmp(str, "tcmalloc") == 0);
+    }
+    str = (char*)realloc(str, 8);
+    assert(memcmp(str, "tcmallo", 7) == 0);
+    assert(realloc(str, 0) == nullptr);
+
+    for (size_t align = 1; align <= 1024 * 1024; align *= 2) {
+        void* aligned = memalign(align, 100);
+        assert(((uintptr_t)aligned % align) == 0);
+        free(aligned);
+        aligned = aligned_alloc(align, align * 3);
+        assert(((uintptr_t)aligned % align) == 0);
+        free(aligned);
+    }
+    void* aligned = nullptr;
+    assert(posix_memalign(&aligned, 3, 100) == EINVAL);
+    assert(posix_memalign(&aligned, 64, 100) == 0);
+    assert(((uintptr_t)aligned % 64) == 0);
+    free(aligned);
+    aligned = valloc(100);
+    assert(((uintptr_t)aligned % getpagesize()) == 0);
+    free(aligned);
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 10000; ++i) {
+        strings.push_back(std::to_string(i));
+    }
+    std::map<int, std::unique_ptr<int[]>> arrays;
+    for (int i = 0; i < 1000; ++i) {
+        arrays[i].reset(new int[i + 1]);
+    }
+    struct alignas(64) CacheLine {
+        char data[64];
+    };
+    CacheLine* line = new CacheLine;
+    assert(((uintptr_t)line % 64) == 0);
+    delete line;
+
+    std::thread t([]() {
+        std::unique_ptr<char[]> buf(new char[1024]);
+        memset(buf.get(), 1, 1024);
+    });
+    t.join();
+
+    printf("Everything is OK!\n");
+}
@@ -8,6 +8,9 @@
 #include "size_class.hpp"
 #include "central_freelist.hpp"
 #include "thread_cache.hpp"
+#include "cpu_cache.hpp"
+#include "background_thread.hpp"
+#include "remote_free.hpp"
 
 /*
 tcmalloc unit test.
@@ -72,6 +75,56 @@ void TestFreeList() {
         check_list.pop_front();
     }
     assert(freelist.Empty());
+    assert(freelist.Head() == nullptr && freelist.Tail() == nullptr);
+
+    // 整段搬运保持对象顺序，尾指针始终指向最后一个对象
+    std::vector<People*> objs;
+    for (int i = 0; i < 10; ++i) {
+        objs.push_back(allocator.Alloc());
+    }
+    for (int i = 9; i >= 0; --i) {
+        freelist.PushFront(objs[i]);
+    }
+    assert(freelist.Tail() == objs[9]);
+    tcmalloc::FreeList other;
+    freelist.PopRange(4, other);
+    assert(other.FreeObjects() == 4 && freelist.FreeObjects() == 6);
+    assert(other.Head() == objs[0] && other.Tail() == objs[3]);
+    assert(freelist.Head() == objs[4] && freelist.Tail() == objs[9]);
+    freelist.PopRange(6, other);
+    assert(freelist.Empty() && freelist.Tail() == nullptr);
+    assert(other.FreeObjects() == 10 && other.Head() == objs[4] && other.Tail() == objs[3]);
+    freelist.Splice(other);
+    assert(other.Empty() && other.Head() == nullptr);
+    assert(freelist.FreeObjects() == 10);
+    for (int i = 4; i < 14; ++i) {
+        assert((People*)freelist.PopFront() == objs[i % 10]);
+    }
+    assert(freelist.Empty() && freelist.Tail() == nullptr);
+
+    // ThreadCacheFreeList被内联路径取空再压入之后，整体取走仍然拿到正确的尾部
+    tcmalloc::internal::FreeListHead head;
+    tcmalloc::ThreadCacheFreeList tc_list;
+    tc_list.Init(1, 8, &head);
+    for (int i = 0; i < 3; ++i) {
+        tc_list.Push(objs[i]);
+    }
+    void* popped;
+    while (head.TryPop(&popped)) {}
+    for (int i = 9; i >= 4; --i) {
+        tc_list.Push(objs[i]);
+    }
+    tc_list.PopFreeList(2, freelist);
+    assert(freelist.Head() == objs[4] && freelist.Tail() == objs[5]);
+    tc_list.PopFreeList(4, other);
+    assert(tc_list.empty() && head.head == nullptr);
+    assert(other.FreeObjects() == 4 && other.Head() == objs[6] && other.Tail() == objs[9]);
+    tc_list.PushFreeList(4, other);
+    tc_list.PopFreeList(4, other);
+    assert(other.Head() == objs[6] && other.Tail() == objs[9]);
+    for (auto obj : objs) {
+        allocator.Free(obj);
+    }
     printf("===================== TestFreeList Finish =====================\n");
 }
 
@@ -106,6 +159,58 @@ void TestSpanSet() {
     printf("===================== TestSpanSet PASS =====================\n");
 }
 
+void TestSpanFreeObjects() {
+    printf("===================== TestSpanFreeObjects BEGIN =====================\n");
+    tcmalloc::PageHeap* page_heap = tcmalloc::PageHeap::Instance();
+    for (uint64_t bytes : {1024, 128, 8192, 64, 8}) {
+        tcmalloc::Span* span = page_heap->New(1);
+        uint64_t objects = span->InitFreeList(bytes);
+        assert(objects == tcmalloc::Span::spanPageSize / bytes);
+        assert(span->use_bitmap == (objects <= tcmalloc::Span::kMaxBitmapObjects));
+        assert(span->FreeObjects() == objects);
+        // 链表方式的span初始化时不切对象，取的时候按地址顺序切
+        assert(span->use_bitmap || (span->freelist.Empty() && span->uncarved == objects));
+
+        tcmalloc::FreeList fl;
+        span->PopFreeObjects(objects / 2, fl);
+        if (!span->use_bitmap) {
+            assert(span->uncarved == objects - objects / 2);
+            char* expect = (char*)(span->page_id * tcmalloc::Span::spanPageSize);
+            for (void* ptr = fl.Head(); ptr != nullptr; ptr = *(void**)ptr) {
+                assert(ptr == expect);
+                expect += bytes;
+            }
+            // 还回来的对象先被用掉
+            void* back = fl.PopFront();
+            span->PushFreeObject(back);
+            tcmalloc::FreeList one;
+            span->PopFreeObjects(1, one);
+            assert(one.Head() == back);
+            fl.Splice(one);
+        }
+        assert(fl.FreeObjects() == objects / 2);
+        assert(span->FreeObjects() == objects - objects / 2);
+        std::set<void*> uniq;
+        char* base = (char*)(span->page_id * tcmalloc::Span::spanPageSize);
+        for (void* ptr = fl.Head(); ptr != nullptr; ptr = *(void**)ptr) {
+            assert(((char*)ptr - base) % bytes == 0);
+            assert((char*)ptr >= base && (char*)ptr + bytes <= base + tcmalloc::Span::spanPageSize);
+            uniq.insert(ptr);
+        }
+        assert(uniq.size() == objects / 2);
+        span->PopFreeObjects(span->FreeObjects(), fl);
+        assert(!span->HasFreeObjects());
+        assert(fl.FreeObjects() == objects);
+
+        while (!fl.Empty()) {
+            span->PushFreeObject(fl.PopFront());
+        }
+        assert(span->FreeObjects() == objects);
+        page_heap->Delete(span);
+    }
+    printf("===================== TestSpanFreeObjects Finish =====================\n");
+}
+
 void TestPageMap() {
     printf("===================== TestPageMap BEGIN =====================\n");
     auto* pm = new tcmalloc::PageMap();
@@ -189,6 +294,207 @@ void TestPageHeap() {
     printf("===================== TestPageHeap Finish =====================\n");
 }
 
+void TestPageHeapResize() {
+    printf("===================== TestPageHeapResize BEGIN =====================\n");
+    auto* page_heap = new tcmalloc::PageHeap();
+
+    tcmalloc::Span* s1 = page_heap->New(10);
+    tcmalloc::Span* s2 = page_heap->New(10);
+    uint64_t page_id = s1->page_id;
+    assert(s2->page_id == page_id + 10);
+    // 下一个span在使用中，不能原地扩大
+    assert(!page_heap->Resize(s1, 11));
+    assert(page_heap->Resize(s1, 4));
+    assert(s1->npages == 4 && s1->page_id == page_id);
+    assert(page_heap->CheckState());
+    assert(page_heap->Resize(s1, 10));
+    assert(s1->npages == 10 && s1->page_id == page_id);
+    assert(page_heap->CheckState());
+    assert(page_heap->Resize(s2, 300));
+    assert(s2->npages == 300);
+    assert(page_heap->CheckState());
+    page_heap->Delete(s2);
+    assert(page_heap->Resize(s1, 200));
+    assert(s1->npages == 200 && s1->page_id == page_id);
+    assert(page_heap->CheckState());
+    page_heap->Delete(s1);
+    assert(page_heap->CheckState());
+
+    std::vector<tcmalloc::Span*> spans;
+    for (int i = 0; i < 1000; ++i) {
+        spans.push_back(page_heap->New((rand() % 150) + 1));
+        tcmalloc::Span* span = spans[rand() % spans.size()];
+        uint64_t old_page_id = span->page_id;
+        uint64_t n = (rand() % 300) + 1;
+        if (page_heap->Resize(span, n)) {
+            assert(span->npages == n && span->page_id == old_page_id);
+        }
+        assert(page_heap->CheckState());
+        if (rand() % 2) {
+            int pos = rand() % spans.size();
+            page_heap->Delete(spans[pos]);
+            assert(page_heap->CheckState());
+            spans.erase(spans.begin() + pos);
+        }
+    }
+    for (auto span : spans) {
+        page_heap->Delete(span);
+        assert(page_heap->CheckState());
+    }
+    delete page_heap;
+    printf("===================== TestPageHeapResize Finish =====================\n");
+}
+
+void TestPageHeapZeroed() {
+    printf("===================== TestPageHeapZeroed BEGIN =====================\n");
+    auto* page_heap = new tcmalloc::PageHeap();
+    const uint64_t page_size = tcmalloc::Span::spanPageSize;
+
+    tcmalloc::Span* s1 = page_heap->New(10);
+    assert(s1->zeroed);
+    memset((void*)(s1->page_id * page_size), 1, 10 * page_size);
+    page_heap->Delete(s1);
+    tcmalloc::Span* s2 = page_heap->New(10);
+    assert(s2->page_id == s1->page_id && !s2->zeroed);
+    page_heap->Delete(s2);
+
+    // zeroed的span每一页都必须是0，取出来之后弄脏每一页
+    for (int i = 0; i < 100; ++i) {
+        std::vector<tcmalloc::Span*> spans;
+        int alloc = (rand() % 100) + 1;
+        for (int j = 0; j < alloc; ++j) {
+            tcmalloc::Span* span = page_heap->New((rand() % 150) + 1);
+            char* start = (char*)(span->page_id * page_size);
+            for (uint64_t k = 0; k < span->npages; ++k) {
+                if (span->zeroed) {
+                    assert(start[k * page_size] == 0);
+                    assert(start[(k + 1) * page_size - 1] == 0);
+                }
+                start[k * page_size] = 1;
+                start[(k + 1) * page_size - 1] = 1;
+            }
+            spans.push_back(span);
+        }
+        for (auto span : spans) {
+            page_heap->Delete(span);
+            assert(page_heap->CheckState());
+        }
+    }
+    delete page_heap;
+    printf("===================== TestPageHeapZeroed Finish =====================\n");
+}
+
+void TestPageHeapHugePage() {
+    printf("===================== TestPageHeapHugePage BEGIN =====================\n");
+    auto* page_heap = new tcmalloc::PageHeap();
+    page_heap->SetHugePageAware(true);
+    const uint64_t huge_pages = 2 * 1024 * 1024 / tcmalloc::Span::spanPageSize;
+
+    // 堆按大页对齐，大span从大页边界开始，边界前空出来的部分留给小span
+    tcmalloc::Span* s1 = page_heap->New(10);
+    assert(s1->page_id % huge_pages == 0);
+    tcmalloc::Span* large = page_heap->New(huge_pages + 44);
+    assert(large->page_id == s1->page_id + huge_pages);
+    tcmalloc::Span* s2 = page_heap->New(10);
+    assert(s2->page_id == s1->page_id + 10);
+    assert(page_heap->CheckState());
+
+    // 只归还完整的大页，s1、s2所在的大页不动
+    page_heap->Delete(large);
+    assert(page_heap->CheckState());
+    tcmalloc::Span* head = page_heap->GetSpanFromPageId(s2->page_id + 10);
+    assert(head->location == tcmalloc::Span::IN_NORMAL);
+    assert(head->page_id + head->npages == s1->page_id + huge_pages);
+    tcmalloc::Span* returned = page_heap->GetSpanFromPageId(s1->page_id + huge_pages);
+    assert(returned->location == tcmalloc::Span::IN_RETURNED);
+    assert(returned->npages % huge_pages == 0);
+
+    // 小span优先放进没有归还的内存
+    tcmalloc::Span* s3 = page_heap->New(20);
+    assert(s3->page_id == s2->page_id + 10);
+    page_heap->Delete(s1);
+    page_heap->Delete(s2);
+    page_heap->Delete(s3);
+    assert(page_heap->CheckState());
+
+    for (int i = 0; i < 100; ++i) {
+        std::vector<tcmalloc::Span*> spans;
+        int alloc = (rand() % 100) + 1;
+        for (int j = 0; j < alloc; ++j) {
+            uint64_t n = (rand() % 2 == 0) ? (rand() % 20) + 1 : (rand() % 600) + 1;
+            tcmalloc::Span* span = page_heap->New(n);
+            assert(span->npages == n);
+            if (n >= huge_pages) {
+                assert(span->page_id % huge_pages == 0);
+            }
+            spans.push_back(span);
+        }
+        for (auto span : spans) {
+            page_heap->Delete(span);
+            assert(page_heap->CheckState());
+        }
+    }
+    delete page_heap;
+
+    // 默认模式不维护huge_normal_，运行时打开大页模式要从已有的空闲span重建
+    page_heap = new tcmalloc::PageHeap();
+    page_heap->SetHugePageAware(false);
+    tcmalloc::Span* big = page_heap->New(3 * huge_pages);
+    page_heap->Delete(big);
+    assert(page_heap->CheckState());
+    page_heap->SetHugePageAware(true);
+    assert(page_heap->CheckState());
+    big = page_heap->New(3 * huge_pages);
+    page_heap->Delete(big);
+    assert(page_heap->CheckState());
+    page_heap->SetHugePageAware(false);
+    assert(page_heap->CheckState());
+    delete page_heap;
+    printf("===================== TestPageHeapHugePage Finish =====================\n");
+}
+
+void TestAlignedAlloc() {
+    printf("===================== TestAlignedAlloc BEGIN =====================\n");
+    for (size_t align = 8; align <= tcmalloc::Span::spanPageSize; align *= 2) {
+        for (size_t size = 0; size <= tcmalloc::kMaxSize; size += 61) {
+            int cl;
+            int plain_cl;
+            assert(tcmalloc::SizeToClass(size, &plain_cl));
+            assert(tcmalloc::AlignedSizeToClass(size, align, &cl));
+            assert(cl >= plain_cl);
+            assert(tcmalloc::ClassSize(cl) >= size);
+            assert(tcmalloc::ClassSize(cl) % align == 0);
+            // 编译期版本和运行时查表结果一致
+            assert(tcmalloc::ConstexprSizeToClass(size, align) == cl);
+        }
+    }
+
+    auto* page_heap = new tcmalloc::PageHeap();
+    std::vector<tcmalloc::Span*> spans;
+    for (int i = 0; i < 1000; ++i) {
+        uint64_t align_pages = 1 << (rand() % 10);
+        uint64_t n = (rand() % 150) + 1;
+        tcmalloc::Span* span = page_heap->NewAligned(n, align_pages);
+        assert(span != nullptr);
+        assert(span->npages == n);
+        assert(span->page_id % align_pages == 0);
+        assert(page_heap->CheckState());
+        spans.push_back(span);
+        if (rand() % 2) {
+            int pos = rand() % spans.size();
+            page_heap->Delete(spans[pos]);
+            assert(page_heap->CheckState());
+            spans.erase(spans.begin() + pos);
+        }
+    }
+    for (auto span : spans) {
+        page_heap->Delete(span);
+        assert(page_heap->CheckState());
+    }
+    delete page_heap;
+    printf("===================== TestAlignedAlloc Finish =====================\n");
+}
+
 void TestCentralFreeList() {
     printf("===================== TestCentralFreeList BEGIN =====================\n");
     for (int cl = 1; cl < tcmalloc::kMaxClass; ++cl) {
@@ -219,6 +525,312 @@ void TestCentralFreeList() {
         }
 
     }
+
+    // 不满一批的交换也走tc_slots，拆分和合并slot
+    {
+        int cl = 1;
+        uint64_t batch = tcmalloc::ClassToMove(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        std::vector<tcmalloc::FreeList> fls(4);
+        central_freelist.FillFreeList(fls[0], 5);
+        central_freelist.FillFreeList(fls[1], batch - 2);
+        central_freelist.FillFreeList(fls[2], batch);
+        central_freelist.FillFreeList(fls[3], 1);
+        assert(central_freelist.CachedObjects() == 0);
+        central_freelist.ReleaseFreeList(fls[0], 5);
+        assert(central_freelist.CachedObjects() == 5);
+        central_freelist.ReleaseFreeList(fls[1], batch - 2);
+        central_freelist.ReleaseFreeList(fls[2], batch);
+        assert(central_freelist.CachedObjects() == 2 * batch + 3);
+        assert(central_freelist.CheckState());
+        central_freelist.FillFreeList(fls[0], 4);
+        assert(fls[0].FreeObjects() == 4);
+        assert(central_freelist.CachedObjects() == 2 * batch - 1);
+        assert(central_freelist.CheckState());
+        // 比tc_slots中多的部分从span取
+        central_freelist.FillFreeList(fls[1], 2 * batch + 1);
+        assert(fls[1].FreeObjects() == 2 * batch + 1);
+        assert(central_freelist.CachedObjects() == 0);
+        assert(central_freelist.CheckState());
+        for (auto& fl : fls) {
+            if (!fl.Empty()) {
+                central_freelist.ReleaseFreeList(fl, fl.FreeObjects());
+                assert(central_freelist.CheckState());
+            }
+        }
+    }
+
+    // 优先从最满的span分配
+    {
+        int cl = 1;
+        uint64_t per_span = tcmalloc::ClassPages(cl) * tcmalloc::Span::spanPageSize / tcmalloc::ClassSize(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        tcmalloc::FreeList all;
+        central_freelist.FillFreeList(all, 3 * per_span);
+        std::map<tcmalloc::Span*, std::vector<void*>> by_span;
+        while (!all.Empty()) {
+            void* ptr = all.PopFront();
+            by_span[tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(ptr))].push_back(ptr);
+        }
+        assert(by_span.size() == 3);
+        std::vector<tcmalloc::Span*> spans;
+        for (auto& it : by_span) {
+            spans.push_back(it.first);
+        }
+        // spans[0]几乎是满的，spans[1]用了一半，spans[2]几乎是空的，一次还回去
+        uint64_t release[3] = {1, per_span / 2, per_span - 1};
+        tcmalloc::FreeList back;
+        for (int i = 0; i < 3; ++i) {
+            for (uint64_t j = 0; j < release[i]; ++j) {
+                back.PushFront(by_span[spans[i]].back());
+                by_span[spans[i]].pop_back();
+            }
+        }
+        central_freelist.ReleaseFreeList(back, back.FreeObjects());
+        assert(central_freelist.CheckState());
+        tcmalloc::FreeList fl;
+        central_freelist.FillFreeList(fl, 1);
+        assert(tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(fl.Head())) == spans[0]);
+        tcmalloc::FreeList fl2;
+        central_freelist.FillFreeList(fl2, 2);
+        assert(tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(fl2.Head())) == spans[1]);
+        by_span[spans[0]].push_back(fl.PopFront());
+        by_span[spans[1]].push_back(fl2.PopFront());
+        by_span[spans[1]].push_back(fl2.PopFront());
+        for (auto& it : by_span) {
+            for (void* ptr : it.second) {
+                back.PushFront(ptr);
+            }
+        }
+        central_freelist.ReleaseFreeList(back, back.FreeObjects());
+        assert(central_freelist.CheckState());
+    }
+
+    // 没有后台线程时不缓存空闲span，全部释放之后span都回到PageHeap
+    assert(!tcmalloc::CentralFreelist::IdleSpanCacheEnabled());
+    {
+        int cl = 1;
+        uint64_t per_span = tcmalloc::ClassPages(cl) * tcmalloc::Span::spanPageSize / tcmalloc::ClassSize(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        tcmalloc::FreeList fl;
+        central_freelist.FillFreeList(fl, 3 * per_span);
+        std::set<tcmalloc::Span*> spans;
+        std::vector<void*> objs;
+        while (!fl.Empty()) {
+            objs.push_back(fl.PopFront());
+            spans.insert(tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(objs.back())));
+        }
+        for (void* ptr : objs) {
+            fl.PushFront(ptr);
+        }
+        assert(spans.size() == 3);
+        std::vector<uint64_t> page_ids;
+        for (auto span : spans) {
+            page_ids.push_back(span->page_id);
+        }
+        central_freelist.ReleaseFreeList(fl, 3 * per_span);
+        assert(central_freelist.IdleSpans() == 0);
+        assert(central_freelist.CheckState());
+        for (auto page_id : page_ids) {
+            tcmalloc::Span* span = tcmalloc::PageHeap::Instance()->GetSpanFromPageId(page_id);
+            assert(span->location != tcmalloc::Span::IN_USE);
+        }
+    }
+
+    // 后台线程运行期间才缓存空闲span，下面用SetIdleSpanCache模拟
+    tcmalloc::CentralFreelist::SetIdleSpanCache(true);
+
+    // 空出来的span先缓存，复用时不经过PageHeap，空闲两个周期后才归还
+    {
+        int cl = 1;
+        uint64_t per_span = tcmalloc::ClassPages(cl) * tcmalloc::Span::spanPageSize / tcmalloc::ClassSize(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        tcmalloc::FreeList fl;
+        central_freelist.FillFreeList(fl, per_span);
+        tcmalloc::Span* span = tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(fl.Head()));
+        central_freelist.ReleaseFreeList(fl, per_span);
+        assert(central_freelist.IdleSpans() == 1);
+        assert(span->location == tcmalloc::Span::IN_USE && span->refcount == 0);
+        assert(central_freelist.CheckState());
+
+        central_freelist.FillFreeList(fl, per_span);
+        assert(central_freelist.IdleSpans() == 0);
+        assert(tcmalloc::PageHeap::Instance()->GetSpanFromPageId(tcmalloc::Span::PageIdFromPtr(fl.Head())) == span);
+        central_freelist.ReleaseFreeList(fl, per_span);
+        assert(central_freelist.IdleSpans() == 1);
+
+        central_freelist.ReleaseIdleSpans();
+        assert(central_freelist.IdleSpans() == 1);
+        assert(central_freelist.CheckState());
+        central_freelist.ReleaseIdleSpans();
+        assert(central_freelist.IdleSpans() == 0);
+        assert(central_freelist.CheckState());
+
+        // 后台线程停止时关掉缓存，调用一次就全部归还
+        central_freelist.FillFreeList(fl, per_span);
+        central_freelist.ReleaseFreeList(fl, per_span);
+        assert(central_freelist.IdleSpans() == 1);
+        tcmalloc::CentralFreelist::SetIdleSpanCache(false);
+        central_freelist.ReleaseIdleSpans();
+        assert(central_freelist.IdleSpans() == 0);
+        assert(central_freelist.CheckState());
+        tcmalloc::CentralFreelist::SetIdleSpanCache(true);
+    }
+
+    // 两个span的对象交替出现时按段查找span
+    {
+        int cl = 1;
+        uint64_t per_span = tcmalloc::ClassPages(cl) * tcmalloc::Span::spanPageSize / tcmalloc::ClassSize(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        tcmalloc::FreeList fl;
+        central_freelist.FillFreeList(fl, 2 * per_span);
+        std::vector<void*> objs;
+        while (!fl.Empty()) {
+            objs.push_back(fl.PopFront());
+        }
+        std::sort(objs.begin(), objs.end());
+        for (uint64_t i = 0; i < per_span; ++i) {
+            fl.PushFront(objs[i]);
+            fl.PushFront(objs[i + per_span]);
+        }
+        central_freelist.ReleaseFreeList(fl, 2 * per_span);
+        assert(central_freelist.IdleSpans() == 2);
+        assert(central_freelist.CheckState());
+    }
+
+    // 取完之后span中剩下不到一批时，后台补充一个空闲span，没有用到时和其他空闲span一样归还
+    {
+        int cl = 1;
+        uint64_t per_span = tcmalloc::ClassPages(cl) * tcmalloc::Span::spanPageSize / tcmalloc::ClassSize(cl);
+        uint64_t batch = tcmalloc::ClassToMove(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        assert(!central_freelist.RefillIfLow());
+        tcmalloc::FreeList fl;
+        central_freelist.FillFreeList(fl, batch);
+        assert(central_freelist.SpanFreeObjects() == per_span - batch);
+        assert(!central_freelist.RefillIfLow());
+
+        tcmalloc::FreeList rest;
+        central_freelist.FillFreeList(rest, per_span - batch - 1);
+        assert(central_freelist.SpanFreeObjects() == 1);
+        assert(central_freelist.RefillIfLow());
+        assert(central_freelist.SpanFreeObjects() == 1);
+        assert(central_freelist.IdleSpans() == 1);
+        assert(!central_freelist.RefillIfLow());
+        assert(central_freelist.CheckState());
+
+        // 补充的span被下一次未命中用掉
+        tcmalloc::FreeList more;
+        central_freelist.FillFreeList(more, batch);
+        assert(central_freelist.IdleSpans() == 0);
+        assert(central_freelist.SpanFreeObjects() == 1 + per_span - batch);
+
+        // 已经有空闲span时不再补充
+        tcmalloc::FreeList others;
+        central_freelist.FillFreeList(others, per_span - batch);
+        assert(central_freelist.SpanFreeObjects() == 1);
+        more.Splice(others);
+        central_freelist.ReleaseFreeList(more, per_span);
+        assert(central_freelist.IdleSpans() == 1);
+        assert(!central_freelist.RefillIfLow());
+
+        // 补充之后没有再取的class，span过两个周期归还，之后也不再补充
+        central_freelist.FillFreeList(more, per_span);
+        assert(central_freelist.SpanFreeObjects() == 1);
+        assert(central_freelist.IdleSpans() == 0);
+        central_freelist.ReleaseIdleSpans();
+        assert(central_freelist.RefillIfLow());
+        assert(central_freelist.IdleSpans() == 1);
+        central_freelist.ReleaseIdleSpans();
+        assert(!central_freelist.RefillIfLow());
+        assert(central_freelist.IdleSpans() == 1);
+        central_freelist.ReleaseIdleSpans();
+        assert(!central_freelist.RefillIfLow());
+        assert(central_freelist.IdleSpans() == 0);
+        assert(central_freelist.SpanFreeObjects() == 1);
+        assert(central_freelist.CheckState());
+    }
+    tcmalloc::CentralFreelist::SetIdleSpanCache(false);
+
+    // 一直从span取对象时batch翻倍，Scavenge归还的闲置对象多时减半
+    {
+        int cl = 1;
+        uint64_t base = tcmalloc::ClassToMove(cl);
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        assert(central_freelist.BatchSize() == base);
+        std::vector<tcmalloc::FreeList> fls(256);
+        for (auto& fl : fls) {
+            central_freelist.FillFreeList(fl, base);
+        }
+        assert(central_freelist.BatchSize() == 2 * base);
+        assert(central_freelist.CheckState());
+        for (auto& fl : fls) {
+            central_freelist.ReleaseFreeList(fl, fl.FreeObjects());
+        }
+        assert(central_freelist.CheckState());
+
+        // 超过一批的交换不经过tc_slots，每次都拿lock_
+        uint64_t N = 4 * base + 1;
+        for (uint64_t expect : {base, base / 2, base / 2}) {
+            central_freelist.RecordStranded(1 << 20);
+            for (int i = 0; i < 128; ++i) {
+                tcmalloc::FreeList fl;
+                central_freelist.FillFreeList(fl, N);
+                central_freelist.ReleaseFreeList(fl, N);
+            }
+            assert(central_freelist.BatchSize() == expect);
+            assert(central_freelist.CheckState());
+        }
+    }
+
+    // 一个窗口里只有不竞争的归还，没有取也没有闲置对象，batch不变
+    {
+        int cl = 1;
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        uint64_t N = 129;
+        std::vector<tcmalloc::FreeList> fls(256);
+        for (auto& fl : fls) {
+            central_freelist.FillFreeList(fl, N);
+        }
+        uint64_t batch = central_freelist.BatchSize();
+        assert(batch < N);
+        for (auto& fl : fls) {
+            central_freelist.ReleaseFreeList(fl, N);
+        }
+        assert(central_freelist.BatchSize() == batch);
+        assert(central_freelist.CheckState());
+    }
+
+    // 多个线程同时整批交换和逐个从span取还，tc_slots和span两把锁交替使用
+    for (int cl : {1, 2, 3, 20}) {
+        tcmalloc::CentralFreelist central_freelist;
+        central_freelist.Init(cl);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&central_freelist, cl, t]() {
+                uint64_t batch = tcmalloc::ClassToMove(cl);
+                for (int i = 0; i < 2000; ++i) {
+                    uint64_t N = (t % 2 == 0) ? batch : (i % batch) + 1;
+                    tcmalloc::FreeList fl;
+                    central_freelist.FillFreeList(fl, N);
+                    assert(fl.FreeObjects() == N);
+                    central_freelist.ReleaseFreeList(fl, N);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        assert(central_freelist.CheckState());
+    }
     printf("===================== TestCentralFreeList Finish =====================\n");
 }
 
@@ -288,16 +900,490 @@ void TestThreadCache() {
     for (auto it = threads.begin(); it != threads.end(); ++it) {
         it->join();
     }
+
+    // 消费者线程的max_length被ListTooLong减到0之后仍然能分配
+    std::thread consumer([]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        int cl = 3;
+        curr->Clear();
+        curr->freelists_[cl].set_max_length(0);
+        void* ptr = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        assert(ptr != nullptr);
+        curr->Free(ptr, cl);
+        curr->Clear();
+    });
+    consumer.join();
     printf("===================== TestThreadCache Finish =====================\n");
 }
 
+void TestThreadCacheBatch() {
+    printf("===================== TestThreadCacheBatch BEGIN =====================\n");
+    std::thread t([]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        for (int cl = 1; cl < tcmalloc::kMaxClass; ++cl) {
+            uint64_t alloc = curr->GetTotalAlloc();
+            uint64_t free = curr->GetTotalFree();
+            int n = (rand() % 500) + 1;
+            std::vector<void*> ptrs(n);
+            assert(curr->AllocBatch(cl, n, ptrs.data()) == n);
+            assert(curr->GetTotalAlloc() == alloc + n * tcmalloc::ClassSize(cl));
+            std::set<void*> uniq(ptrs.begin(), ptrs.end());
+            assert(uniq.size() == n);
+            for (auto ptr : ptrs) {
+                memset(ptr, 1, tcmalloc::ClassSize(cl));
+            }
+            curr->FreeBatch(cl, ptrs.data(), n);
+            assert(curr->GetTotalFree() == free + n * tcmalloc::ClassSize(cl));
+        }
+        curr->Clear();
+        assert(curr->UsedSize() == 0);
+    });
+    t.join();
+    printf("===================== TestThreadCacheBatch Finish =====================\n");
+}
+
+void TestThreadCacheActiveClasses() {
+    printf("===================== TestThreadCacheActiveClasses BEGIN =====================\n");
+    std::thread t([]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        curr->Clear();
+        // 配额足够大，只有手动调用时才Scavenge
+        uint64_t max_size = curr->hot_.max_size.exchange(1 << 30);
+        for (int cl = 1; cl < tcmalloc::kMaxClass; ++cl) {
+            assert(!curr->IsActive(cl));
+        }
+        assert(curr->NextActiveClass(0) == -1);
+
+        // 40个class各放一个对象
+        std::vector<int> cls;
+        for (int cl = 2; cl < 82; cl += 2) {
+            curr->Free(curr->Alloc(tcmalloc::ClassSize(cl), cl), cl);
+            cls.push_back(cl);
+        }
+        for (int cl = 1; cl < tcmalloc::kMaxClass; ++cl) {
+            assert(curr->IsActive(cl) == (std::find(cls.begin(), cls.end(), cl) != cls.end()));
+        }
+        int prev = -1;
+        for (int cl : cls) {
+            assert(curr->NextActiveClass(prev + 1) == cl);
+            prev = cl;
+        }
+        assert(curr->NextActiveClass(prev + 1) == -1);
+
+        // 每次Scavenge最多处理16个class，lowater被重置的class逐次增加
+        auto count_reset = [curr, &cls]() {
+            int n = 0;
+            for (int cl : cls) {
+                if (curr->freelists_[cl].lowwatermark() == curr->freelists_[cl].length()) n++;
+            }
+            return n;
+        };
+        for (int cl : cls) {
+            curr->hot_.lists[cl].lowater = 0;
+        }
+        curr->Scavenge();
+        assert(count_reset() == 16);
+        curr->Scavenge();
+        assert(count_reset() == 32);
+        curr->Scavenge();
+        assert(count_reset() == 40);
+
+        // 一直没有使用的class被逐步归还，空了之后不再活跃
+        for (int i = 0; i < 20; ++i) {
+            curr->Scavenge();
+        }
+        for (int cl : cls) {
+            assert(curr->freelists_[cl].empty());
+            assert(!curr->IsActive(cl));
+        }
+        curr->Clear();
+        assert(curr->UsedSize() == 0);
+        assert(curr->NextActiveClass(0) == -1);
+        // Scavenge期间领取或者窃取的配额要保留，否则总配额对不上
+        curr->hot_.max_size.fetch_sub((1 << 30) - max_size);
+    });
+    t.join();
+    printf("===================== TestThreadCacheActiveClasses Finish =====================\n");
+}
+
+void TestThreadCacheResize() {
+    printf("===================== TestThreadCacheResize BEGIN =====================\n");
+    // 多个线程领取和窃取配额的同时调整总大小，配额不能丢失或者重复计算
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&stop]() {
+            tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+            while (!stop.load(std::memory_order_relaxed)) {
+                curr->ClaimUnclaimedSpace();
+                curr->IncreaseCacheLimit();
+            }
+        });
+    }
+    for (int i = 0; i < 2000; ++i) {
+        tcmalloc::ThreadCache::SetOverAllThreadCacheSize((i % 2 == 0) ? (8 << 20) : (64 << 20));
+    }
+    stop.store(true);
+    for (auto it = threads.begin(); it != threads.end(); ++it) {
+        it->join();
+    }
+    assert(tcmalloc::ThreadCache::CacheSpaceDrift() == 0);
+    tcmalloc::ThreadCache::SetOverAllThreadCacheSize(32 << 20);
+    assert(tcmalloc::ThreadCache::CacheSpaceDrift() == 0);
+    printf("===================== TestThreadCacheResize Finish =====================\n");
+}
+
+void TestCpuCache() {
+    printf("===================== TestCpuCache BEGIN =====================\n");
+    tcmalloc::CpuCache::SetEnabled(true);
+    assert(tcmalloc::CpuCache::Enabled());
+    tcmalloc::CpuCache* cpu_cache = tcmalloc::CpuCache::Instance();
+    // rseq和加锁两种模式各跑一遍，不支持rseq时两遍都是加锁
+    bool rseq = tcmalloc::CpuCache::UseRseq();
+    printf("per-cpu cache uses rseq: %d\n", rseq);
+    for (int mode = 0; mode < 2; ++mode) {
+        tcmalloc::CpuCache::SetUseRseq(mode == 0 && rseq);
+        std::atomic<bool> done(false);
+        // 一边分配释放一边Clear，Clear要让其他cpu上的临界区重来
+        std::thread clearer([cpu_cache, &done]() {
+            while (!done.load()) {
+                cpu_cache->Clear();
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 16; ++i) {
+            threads.emplace_back([cpu_cache, i]() {
+                for (int k = 0; k < 10; ++k) {
+                    int alloc = (rand() % (1024*10)) + 1;
+                    std::vector<void*> ptrs(alloc);
+                    std::vector<int> cls(alloc);
+                    std::vector<int> sizes(alloc);
+                    for (int j = 0; j < alloc; ++j) {
+                        sizes[j] = (rand() % 2000) + 1;
+                        assert(tcmalloc::SizeToClass(sizes[j], &cls[j]));
+                        ptrs[j] = cpu_cache->Alloc(cls[j]);
+                        memset(ptrs[j], i + 1, sizes[j]);
+                    }
+                    // 同一个对象被分给两个线程时内容会被改掉
+                    for (int j = 0; j < alloc; ++j) {
+                        unsigned char* p = static_cast<unsigned char*>(ptrs[j]);
+                        assert(p[0] == i + 1 && p[sizes[j] - 1] == i + 1);
+                        cpu_cache->Free(ptrs[j], cls[j]);
+                    }
+                }
+            });
+        }
+        for (auto it = threads.begin(); it != threads.end(); ++it) {
+            it->join();
+        }
+        done = true;
+        clearer.join();
+        cpu_cache->Clear();
+        assert(cpu_cache->UsedSize() == 0);
+    }
+    tcmalloc::CpuCache::SetUseRseq(rseq);
+
+    std::vector<void*> ptrs(1000);
+    for (auto& ptr : ptrs) {
+        ptr = cpu_cache->Alloc(5);
+    }
+    for (auto& ptr : ptrs) {
+        cpu_cache->Free(ptr, 5);
+    }
+    assert(cpu_cache->UsedSize() > 0);
+    cpu_cache->Clear();
+    assert(cpu_cache->UsedSize() == 0);
+    tcmalloc::CpuCache::SetEnabled(false);
+    assert(!tcmalloc::CpuCache::Enabled());
+    printf("===================== TestCpuCache Finish =====================\n");
+}
+
+void TestCpuCacheLimit() {
+    printf("===================== TestCpuCacheLimit BEGIN =====================\n");
+    // 绑定到当前cpu，所有对象都进同一个cpu的缓存
+    cpu_set_t old_set;
+    assert(sched_getaffinity(0, sizeof(old_set), &old_set) == 0);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(tcmalloc::CpuCache::CurrentCpu(), &set);
+    bool pinned = sched_setaffinity(0, sizeof(set), &set) == 0;
+    tcmalloc::CpuCache::SetEnabled(true);
+    tcmalloc::CpuCache* cpu_cache = tcmalloc::CpuCache::Instance();
+    cpu_cache->Clear();
+    // 每个class释放256KB，总共远超过kPerCpuCacheSize
+    for (int cl = 1; cl < tcmalloc::kMaxClass; ++cl) {
+        size_t n = std::max<size_t>((256 << 10) / tcmalloc::ClassSize(cl), 1);
+        std::vector<void*> ptrs(n);
+        for (size_t i = 0; i < n; ++i) {
+            ptrs[i] = cpu_cache->Alloc(cl);
+            assert(ptrs[i] != nullptr);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            cpu_cache->Free(ptrs[i], cl);
+            if (pinned) {
+                assert(cpu_cache->UsedSize() <= tcmalloc::CpuCache::kPerCpuCacheSize);
+            }
+        }
+    }
+    cpu_cache->Clear();
+    assert(cpu_cache->UsedSize() == 0);
+    tcmalloc::CpuCache::SetEnabled(false);
+    if (pinned) {
+        sched_setaffinity(0, sizeof(old_set), &old_set);
+    }
+    printf("===================== TestCpuCacheLimit Finish =====================\n");
+}
+
+void TestBackgroundThread() {
+    printf("===================== TestBackgroundThread BEGIN =====================\n");
+    std::thread t([]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        int cl = 5;
+        std::vector<void*> ptrs(100);
+        for (auto& ptr : ptrs) {
+            ptr = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        }
+        for (int i = 1; i < ptrs.size(); ++i) {
+            curr->Free(ptrs[i], cl);
+        }
+        assert(curr->UsedSize() > 0);
+
+        // 两个周期之间有分配释放，不是空闲的
+        tcmalloc::BackgroundThread::Tick();
+        curr->Free(curr->Alloc(tcmalloc::ClassSize(cl), cl), cl);
+        // Tick打开交接之后，这次分配释放就确认了交接
+        assert(curr->hot_.handoff.load() == tcmalloc::internal::HandoffEnabled());
+        tcmalloc::BackgroundThread::Tick();
+        assert(!curr->hot_.scavenge_requested.load());
+
+        // 一整个周期没有分配释放，后台线程直接把缓存的对象全部还回去；
+        // 内核不支持membarrier时由下一次Free还回去
+        tcmalloc::BackgroundThread::Tick();
+        if (curr->hot_.scavenge_requested.load()) {
+            curr->Free(ptrs[0], cl);
+            assert(!curr->hot_.scavenge_requested.load());
+            assert(curr->UsedSize() == tcmalloc::ClassSize(cl));
+        } else {
+            assert(curr->UsedSize() == 0);
+            assert(!curr->hot_.parked.load());
+            curr->Free(ptrs[0], cl);
+        }
+        curr->Clear();
+    });
+    t.join();
+
+    // 线程阻塞之后不再分配释放，缓存也要由其他线程调用的Tick回收
+    std::mutex mu;
+    std::condition_variable cv;
+    bool ready = false;
+    bool done = false;
+    tcmalloc::ThreadCache* idle_cache = nullptr;
+    std::thread idle([&]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        int cl = 9;
+        std::vector<void*> objs(200);
+        for (auto& obj : objs) {
+            obj = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        }
+        for (auto obj : objs) {
+            curr->Free(obj, cl);
+        }
+        std::unique_lock<std::mutex> lock(mu);
+        idle_cache = curr;
+        ready = true;
+        cv.notify_all();
+        cv.wait(lock, [&]() { return done; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mu);
+        cv.wait(lock, [&]() { return ready; });
+    }
+    assert(idle_cache->UsedSize() > 0);
+    tcmalloc::BackgroundThread::Tick();
+    tcmalloc::BackgroundThread::Tick();
+    assert(idle_cache->UsedSize() == 0 || idle_cache->hot_.scavenge_requested.load());
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        done = true;
+        cv.notify_all();
+    }
+    idle.join();
+
+    // 线程时断时续地分配释放，后台线程反复在它停下的间隙代为归还，链表不能被破坏
+    std::atomic<bool> stop(false);
+    std::thread bursty([&stop]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        std::vector<void*> objs(64);
+        for (int round = 0; round < 400; ++round) {
+            int cl = 1 + round % 16;
+            for (auto& obj : objs) {
+                obj = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+                memset(obj, round & 0xff, tcmalloc::ClassSize(cl));
+            }
+            for (auto obj : objs) {
+                assert(*reinterpret_cast<unsigned char*>(obj) == (round & 0xff));
+                curr->Free(obj, cl);
+            }
+            if (round % 4 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+        stop.store(true);
+    });
+    while (!stop.load()) {
+        tcmalloc::BackgroundThread::Tick();
+    }
+    bursty.join();
+
+    tcmalloc::BackgroundThread& bg = tcmalloc::BackgroundThread::Instance();
+    assert(bg.Start(1));
+    assert(bg.Start(5));
+    assert(bg.Running());
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    bg.Stop();
+    assert(!bg.Running());
+    bg.Stop();
+    printf("===================== TestBackgroundThread Finish =====================\n");
+}
+
+void TestRemoteFree() {
+    printf("===================== TestRemoteFree BEGIN =====================\n");
+    std::thread t([]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        int owner = curr->RemoteOwner();
+        assert(owner >= 0);
+        int cl = 7;
+        std::vector<void*> ptrs(300);
+        for (auto& ptr : ptrs) {
+            ptr = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        }
+        // 比tc_slots中的对象多取一个，最后一个一定从span取，记录owner，
+        // 从span取的对象接在链表前面
+        tcmalloc::CentralFreelist& central = tcmalloc::ThreadCache::Central(cl);
+        tcmalloc::FreeList fl;
+        uint64_t N = central.CachedObjects() + 1;
+        central.FillFreeList(fl, N, owner);
+        tcmalloc::Span* span = tcmalloc::PageHeap::Instance()->GetSpanFromPageId(
+                tcmalloc::Span::PageIdFromPtr(fl.Head()));
+        assert(span->owner == owner);
+        central.ReleaseFreeList(fl, N);
+
+        // 其他线程并发地压入owner的队列
+        std::vector<std::thread> freers;
+        for (int i = 0; i < 4; ++i) {
+            freers.emplace_back([&ptrs, owner, cl, i]() {
+                for (int j = i; j < ptrs.size(); j += 4) {
+                    assert(tcmalloc::RemoteFree::Push(owner, cl, ptrs[j]));
+                }
+            });
+        }
+        for (auto& freer : freers) {
+            freer.join();
+        }
+
+        // 本地链表空了之后先取走队列，不找CentralFreelist
+        curr->Clear();
+        assert(curr->UsedSize() == 0);
+        std::set<void*> uniq(ptrs.begin(), ptrs.end());
+        void* ptr = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        assert(uniq.count(ptr) == 1);
+        assert(curr->UsedSize() == (ptrs.size() - 1) * tcmalloc::ClassSize(cl));
+        assert(tcmalloc::RemoteFree::TakeAll(owner, cl) == nullptr);
+        curr->Free(ptr, cl);
+        curr->Clear();
+
+        // 线程退出之后不再接收
+        tcmalloc::RemoteFree::RetireOwner(owner);
+        void* obj = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        assert(!tcmalloc::RemoteFree::Push(owner, cl, obj));
+        curr->Free(obj, cl);
+    });
+    t.join();
+    printf("===================== TestRemoteFree Finish =====================\n");
+}
+
+void TestRemoteFreeBound() {
+    printf("===================== TestRemoteFreeBound BEGIN =====================\n");
+    int cl = 12;
+    std::mutex mu;
+    std::condition_variable cv;
+    int owner = -1;
+    tcmalloc::ThreadCache* owner_cache = nullptr;
+    bool exit_owner = false;
+    std::thread t([&]() {
+        tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+        std::unique_lock<std::mutex> lock(mu);
+        owner = curr->RemoteOwner();
+        owner_cache = curr;
+        cv.notify_all();
+        cv.wait(lock, [&]() { return exit_owner; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mu);
+        cv.wait(lock, [&]() { return owner_cache != nullptr; });
+    }
+    assert(owner >= 0);
+
+    // owner不再分配，队列满了之后压入失败，由调用者按普通释放处理
+    tcmalloc::ThreadCache* curr = tcmalloc::ThreadCache::Current();
+    std::vector<void*> rejected;
+    size_t pushed = 0;
+    while (rejected.size() < 10) {
+        void* obj = curr->Alloc(tcmalloc::ClassSize(cl), cl);
+        if (tcmalloc::RemoteFree::Push(owner, cl, obj)) {
+            pushed++;
+        } else {
+            rejected.push_back(obj);
+        }
+        assert(tcmalloc::RemoteFree::QueuedBytes(owner) <= tcmalloc::RemoteFree::kMaxQueuedBytes);
+    }
+    assert(pushed * tcmalloc::ClassSize(cl) <= tcmalloc::RemoteFree::kMaxQueuedBytes);
+    assert((pushed + 1) * tcmalloc::ClassSize(cl) > tcmalloc::RemoteFree::kMaxQueuedBytes);
+    for (auto obj : rejected) {
+        curr->Free(obj, cl);
+    }
+
+    // Scavenge把队列取进本线程缓存
+    owner_cache->Scavenge();
+    assert(tcmalloc::RemoteFree::QueuedBytes(owner) == 0);
+    assert(owner_cache->UsedSize() >= pushed * tcmalloc::ClassSize(cl));
+
+    // 退出时队列里的对象全部取走，不会留到槽位被复用
+    for (int i = 0; i < 100; ++i) {
+        assert(tcmalloc::RemoteFree::Push(owner, cl, curr->Alloc(tcmalloc::ClassSize(cl), cl)));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        exit_owner = true;
+        cv.notify_all();
+    }
+    t.join();
+    assert(tcmalloc::RemoteFree::QueuedBytes(owner) == 0);
+    curr->Clear();
+    printf("===================== TestRemoteFreeBound Finish =====================\n");
+}
+
 int main()
 {
     TestFixAllocator();
     TestFreeList();
     TestSpanSet();
+    TestSpanFreeObjects();
     TestPageMap();
     TestPageHeap();
+    TestPageHeapResize();
+    TestPageHeapZeroed();
+    TestPageHeapHugePage();
+    TestAlignedAlloc();
     TestCentralFreeList();
     TestThreadCache();
+    TestThreadCacheBatch();
+    TestThreadCacheActiveClasses();
+    TestThreadCacheResize();
+    TestCpuCache();
+    TestCpuCacheLimit();
+    TestBackgroundThread();
+    TestRemoteFree();
+    TestRemoteFreeBound();
 }
@@ -5,7 +5,13 @@
 #ifndef TCMALLOC_TCMALLOC_H
 #define TCMALLOC_TCMALLOC_H
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "tcmalloc_size_class.h"
 
 namespace tcmalloc {
 
@@ -13,12 +19,212 @@ namespace tcmalloc {
 
     void free(void* ptr);
 
+    // size必须是malloc/calloc/realloc时传入的大小，
+    // 小对象直接由size算出class，不查PageMap也不访问span
+    void free_sized(void* ptr, size_t size);
+
+    // n*size溢出时返回nullptr
+    void *calloc(size_t n, size_t size);
+
+    // ptr为nullptr时等价于malloc，size为0时释放ptr并返回nullptr
+    void *realloc(void* ptr, size_t size);
+
+    // align必须是2的幂，否则返回nullptr
+    void *memalign(size_t align, size_t size);
+
+    // 释放memalign(align, size)返回的指针，与free_sized一样不查PageMap
+    void free_aligned_sized(void* ptr, size_t align, size_t size);
+
+    // 分配n个size字节的对象写入out，返回成功分配的个数
+    size_t malloc_batch(size_t size, size_t n, void** out);
+
+    // 释放ptrs中的n个指针，来自同一个span的连续指针只查一次PageMap
+    void free_batch(void** ptrs, size_t n);
+
+    // ptr实际可用的字节数，ptr必须是本分配器返回的指针
+    size_t usable_size(void* ptr);
+
+    // malloc(size)实际会分配的字节数，不分配内存
+    size_t good_size(size_t size);
+
+    // 与malloc相同，同时通过capacity返回实际可用的字节数，
+    // 调用者可以直接使用[size, *capacity)这部分空间
+    void *malloc_with_capacity(size_t size, size_t* capacity);
+
     void clear_current_cache();
 
     size_t current_used_size();
 
     void set_overall_thread_cache_size(size_t new_size);
 
+    // 打开后小对象由每个cpu的缓存提供，不再创建ThreadCache，
+    // 也可以设置环境变量TCMALLOC_PER_CPU_CACHES=1打开。
+    // x86_64上glibc注册了rseq时快路径不加锁；否则每次操作都要加锁，比ThreadCache慢
+    void set_per_cpu_caches(bool enabled);
+
+    // 所有cpu缓存中对象的总字节数
+    size_t per_cpu_caches_used_size();
+
+    // 打开后其他线程释放的小对象无锁地交还给分配它的线程，
+    // 适合一个线程分配另一个线程释放的场景，
+    // 也可以设置环境变量TCMALLOC_REMOTE_FREE=1打开
+    void set_remote_free(bool enabled);
+
+    // 打开后堆按2MB的透明大页组织：大块内存独占整个大页，小块内存紧凑地放在
+    // 尽量少的大页里，只有整个大页空闲时才归还给系统，减少TLB未命中。
+    // 也可以设置环境变量TCMALLOC_HUGEPAGE=1打开
+    void set_hugepage_aware(bool enabled);
+
+    // 启动后台线程，每interval_ms毫秒检查一次，一个周期内没有分配释放的
+    // 线程由后台线程把它缓存的对象还给中心缓存。重复调用只更新周期。
+    // 运行期间中心缓存会留下少量刚空出来的span，空闲两个周期后才归还
+    bool start_background_thread(uint64_t interval_ms);
+
+    // 停止时把中心缓存留下的空闲span全部归还
+    void stop_background_thread();
+
+    namespace internal {
+
+        // ThreadCache中一个class的空闲链表头，分配释放用到的字段都在这16字节里，
+        // 一个cache line放4个class
+        struct FreeListHead {
+            void*    head = nullptr;
+            uint32_t length = 0;
+            // 两次Scavenge之间length的最小值，超过65535时按65535算
+            uint16_t lowater = 0;
+            // length超过max_length时ListTooLong归还一批
+            uint16_t max_length = 0;
+
+            uint32_t Push(void* ptr) {
+                *(reinterpret_cast<void **>(ptr)) = head;
+                head = ptr;
+                return ++length;
+            }
+
+            bool TryPop(void** rv) {
+                if (length == 0) {
+                    return false;
+                }
+                void* ptr = head;
+                head = *(reinterpret_cast<void **>(ptr));
+                length--;
+                if (length < lowater) lowater = length;
+                *rv = ptr;
+                return true;
+            }
+        };
+        static_assert(sizeof(FreeListHead) == 16, "FreeListHead must not straddle cache lines");
+
+        static const int kActiveWords = (kMaxClass + 63) / 64;
+
+        // ThreadCache每次分配释放都要访问的数据：第一个cache line是计数，
+        // 后面是按cache line对齐的链表头。命中时一次分配或释放只访问两个cache line，
+        // 调节用的字段在ThreadCacheFreeList中，只有慢路径才访问
+        struct alignas(64) ThreadCacheHot {
+            // 当size>=max_size时执行Scavenge释放部分objects到centrallist
+            uint64_t size = 0;
+            uint64_t total_alloc = 0;
+            uint64_t total_free = 0;
+            // 其他线程窃取配额时会无锁地修改
+            std::atomic<uint64_t> max_size{0};
+            // 内核不支持membarrier时后台线程设置，线程自己在Alloc/Free时检查并清除
+            std::atomic<bool> scavenge_requested{false};
+            // 所属线程操作链表期间为true，见EnterHot
+            std::atomic<bool> in_use{false};
+            // 后台线程代为归还期间为true，所属线程看到后等归还结束再操作链表
+            std::atomic<bool> parked{false};
+            // 所属线程第一次在hot_handoff置位之后操作链表时置位，
+            // 这之后它的每次操作都设置in_use，后台线程才可以代为归还
+            std::atomic<bool> handoff{false};
+            // 链表非空的class一定置位，Scavenge和Clear只遍历置位的class
+            uint64_t active[kActiveWords] = {};
+
+            alignas(64) FreeListHead lists[kMaxClass];
+        };
+
+        // 后台线程第一次代为归还空闲线程的缓存之前置位，之后不再清除。
+        // 没有置位时不需要EnterHot/LeaveHot，快路径上只多读一次这个变量
+        extern std::atomic<bool> hot_handoff;
+
+        inline bool HandoffEnabled() {
+            return hot_handoff.load(std::memory_order_relaxed);
+        }
+
+        // HandoffEnabled时所属线程操作链表前调用，后台线程正在代为归还时返回false。
+        // 这里只有编译器屏障，store-load需要的处理器屏障由后台线程的membarrier补上，
+        // 快路径上只多两次普通的写和两次读
+        inline bool EnterHot(ThreadCacheHot* hot) {
+            hot->in_use.store(true, std::memory_order_relaxed);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            if (hot->parked.load(std::memory_order_acquire)) {
+                hot->in_use.store(false, std::memory_order_relaxed);
+                return false;
+            }
+            if (!hot->handoff.load(std::memory_order_relaxed)) {
+                hot->handoff.store(true, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        inline void LeaveHot(ThreadCacheHot* hot) {
+            hot->in_use.store(false, std::memory_order_release);
+        }
+
+        // 当前线程的ThreadCache还没有创建时为nullptr
+        extern __thread ThreadCacheHot* tls_hot __attribute__((tls_model("initial-exec")));
+
+        // 线程缓存未命中时的慢路径，cl为0时按size和align走大对象分配
+        void* AllocSlow(int cl, size_t size, size_t align);
+
+        template<size_t Size, size_t Align>
+        inline void* AllocFixed() {
+            constexpr int cl = ConstexprSizeToClass(Size, Align);
+            ThreadCacheHot* hot = tls_hot;
+            bool handoff = HandoffEnabled();
+            if (cl != 0 && hot != nullptr && (!handoff || EnterHot(hot))) {
+                void* rv;
+                bool hit = hot->lists[cl].TryPop(&rv);
+                if (hit) {
+                    hot->size -= ClassSize(cl);
+                    hot->total_alloc += ClassSize(cl);
+                }
+                if (handoff) {
+                    LeaveHot(hot);
+                }
+                if (hit) {
+                    return rv;
+                }
+            }
+            return AllocSlow(cl, Size, Align);
+        }
+
+    }
+
+    // 编译期确定class的malloc，线程缓存命中时完全内联
+    template<size_t Size>
+    inline void *malloc() {
+        return internal::AllocFixed<Size, 8>();
+    }
+
+    // 用tcmalloc分配并构造T，内存不足时返回nullptr，必须用Delete释放
+    template<class T, class... Args>
+    inline T* New(Args&&... args) {
+        void* ptr = internal::AllocFixed<sizeof(T), alignof(T)>();
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    template<class T>
+    inline void Delete(T* ptr) {
+        if (ptr == nullptr) {
+            return;
+        }
+        ptr->~T();
+        free_aligned_sized(ptr, alignof(T), sizeof(T));
+    }
+
 }
 
 #endif //TCMALLOC_TCMALLOC_H
@@ -0,0 +1,113 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#ifndef TCMALLOC_BACKGROUND_THREAD_HPP
+#define TCMALLOC_BACKGROUND_THREAD_HPP
+
+#include <atomic>
+#include <mutex>
+#include <ctime>
+
+#include "pthread.h"
+#include "thread_cache.hpp"
+
+namespace tcmalloc {
+
+// 可选的后台维护线程，默认不启动。
+// 周期性找出空闲的ThreadCache，把它们缓存的对象还给CentralFreelist，
+// 并把CentralFreelist中空闲了一个周期的span还给PageHeap，
+// 给快取空的CentralFreelist提前准备span。
+// 对象是静态的且析构平凡，不注册atexit，进程退出时线程直接随进程结束
+class BackgroundThread {
+public:
+    static BackgroundThread& Instance() {
+        return instance_;
+    }
+
+    constexpr BackgroundThread() {}
+
+    // 已经在运行时只更新周期
+    bool Start(uint64_t interval_ms) {
+        if (interval_ms == 0) {
+            interval_ms = 1;
+        }
+        interval_ms_.store(interval_ms, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> guard(lock_);
+        if (running_) {
+            return true;
+        }
+        stop_.store(false, std::memory_order_relaxed);
+        CentralFreelist::SetIdleSpanCache(true);
+        if (pthread_create(&thread_, nullptr, Run, this) != 0) {
+            CentralFreelist::SetIdleSpanCache(false);
+            return false;
+        }
+        running_ = true;
+        return true;
+    }
+
+    // 停止后没有人再归还空闲span，关掉缓存并把已经缓存的还给PageHeap
+    void Stop() {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!running_) {
+            return;
+        }
+        stop_.store(true, std::memory_order_relaxed);
+        pthread_join(thread_, nullptr);
+        running_ = false;
+        CentralFreelist::SetIdleSpanCache(false);
+        ThreadCache::ReleaseIdleCentralSpans();
+    }
+
+    bool Running() {
+        std::lock_guard<std::mutex> guard(lock_);
+        return running_;
+    }
+
+    // 一个周期要做的事情，测试可以直接调用
+    static void Tick() {
+        ThreadCache::ReleaseIdleCaches();
+        // 先归还再补充，补充的span没有用到时也要留满一个周期才归还
+        ThreadCache::ReleaseIdleCentralSpans();
+        ThreadCache::RefillCentralFreelists();
+    }
+
+private:
+    static const uint64_t kPollMs = 10;
+
+    static void* Run(void* arg) {
+        BackgroundThread* self = static_cast<BackgroundThread*>(arg);
+        uint64_t waited = 0;
+        // 按kPollMs分段睡眠，Stop不用等满一个周期
+        while (!self->stop_.load(std::memory_order_relaxed)) {
+            uint64_t interval = self->interval_ms_.load(std::memory_order_relaxed);
+            if (waited >= interval) {
+                waited = 0;
+                Tick();
+                continue;
+            }
+            uint64_t ms = interval - waited < kPollMs ? interval - waited : kPollMs;
+            struct timespec ts;
+            ts.tv_sec = ms / 1000;
+            ts.tv_nsec = (ms % 1000) * 1000000;
+            nanosleep(&ts, nullptr);
+            waited += ms;
+        }
+        return nullptr;
+    }
+
+    std::mutex lock_;
+    bool running_ = false;
+    pthread_t thread_ = 0;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> interval_ms_{1000};
+
+    static BackgroundThread instance_;
+};
+
+BackgroundThread BackgroundThread::instance_;
+
+}
+
+#endif //TCMALLOC_BACKGROUND_THREAD_HPP
@@ -12,6 +12,7 @@
 #include "size_class.hpp"
 #include "page_heap.hpp"
 #include "fixed_allocator.hpp"
+#include "spin_lock.hpp"
 
 namespace tcmalloc {
 
@@ -22,47 +23,223 @@ public:
         class_pages_ = ClassPages(cl);
         class_bytes_ = ClassSize(cl);
         num_to_move_ = ClassToMove(cl);
+        objects_per_span_ = (class_pages_ * Span::spanPageSize) / class_bytes_;
+
+        // 一批最少是默认值的一半；最多是默认值的4倍，不超过kMaxBatchSize和一个span的对象数
+        min_batch_ = std::max<uint64_t>(1, num_to_move_ / 2);
+        max_batch_ = std::min<uint64_t>(4 * num_to_move_, uint64_t(kMaxBatchSize));
+        max_batch_ = std::min<uint64_t>(max_batch_, objects_per_span_);
+        max_batch_ = std::max<uint64_t>(max_batch_, num_to_move_);
+        locked_ops_ = 0;
+        contended_ops_ = 0;
+        fill_ops_ = 0;
+        fetched_objects_ = 0;
+        stranded_objects_.store(0, std::memory_order_relaxed);
 
         cache_used_ = 0;
-        cache_size_ = (1024 * 1024) / (class_bytes_ * num_to_move_);
-        cache_size_ = std::max(1, cache_size_);
-        cache_size_ = std::min(64, cache_size_);
-        assert(1 <= cache_size_ && cache_size_ <= 64);
+        cached_objects_ = 0;
+        SetBatchSize(num_to_move_);
 
         span_nums_ = 0;
         free_objects_ = 0;
 
         ListInit(&empty_);
-        ListInit(&nonempty_);
+        for (int i = 0; i < kOccupancyBuckets; ++i) {
+            ListInit(&nonempty_[i]);
+        }
+        ListInit(&idle_new_);
+        ListInit(&idle_old_);
+        idle_spans_ = 0;
+        max_idle_spans_ = kIdleSpanBytes / (class_pages_ * Span::spanPageSize);
+        max_idle_spans_ = std::max<uint64_t>(1, max_idle_spans_);
     }
 
-    int FillFreeList(FreeList& freelist, uint64_t N) {
+    // 先从tc_slots取，由tc_lock_保护，不需要查PageMap；
+    // tc_slots中的对象不够时才拿lock_从span取剩下的部分。
+    // 两把锁的顺序是先lock_后tc_lock_，只用tc_slots的路径不会拿lock_
+    // owner>=0时记录到取出对象的span上，见RemoteFree
+    int FillFreeList(FreeList& freelist, uint64_t N, int owner = -1) {
         assert(freelist.Empty());
-        std::lock_guard<std::mutex> guard(lock_);
-        if (N == num_to_move_ && cache_used_ > 0) {
-            freelist = tc_slots[cache_used_-1];
-            cache_used_--;
-            assert(freelist.FreeObjects() == N);
+        uint64_t got = TakeFromSlots(freelist, N);
+        if (got == N) {
             return N;
         }
-        return FetchFromSpans(freelist, N);
+        std::unique_lock<std::mutex> guard = LockSpans();
+        fill_ops_++;
+        int fetched = FetchFromSpans(guard, freelist, N - got, owner);
+        fetched_objects_ += got + fetched;
+        MaybeAdjustBatchSize();
+        return got + fetched;
     }
 
     void ReleaseFreeList(FreeList& freelist, uint64_t N) {
         assert(!freelist.Empty());
-        std::lock_guard<std::mutex> guard(lock_);
-        if (N == num_to_move_ && cache_used_ < cache_size_) {
-            tc_slots[cache_used_] = freelist;
-            cache_used_++;
+        assert(freelist.FreeObjects() == N);
+        if (PutToSlots(freelist, N)) {
             return;
         }
-        return ReleaseToSpans(freelist, N);
+        std::unique_lock<std::mutex> guard = LockSpans();
+        ReleaseToSpans(freelist);
+        MaybeAdjustBatchSize();
+    }
+
+    // ThreadCache和CpuCache每次和CentralFreelist交换的对象数，
+    // 运行时在[min_batch_, max_batch_]之间调整，见MaybeAdjustBatchSize
+    uint64_t BatchSize() const {
+        return batch_size_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t MaxBatchSize() const {
+        return max_batch_;
+    }
+
+    // ThreadCache的Scavenge归还了一段时间内没有用到的n个对象，
+    // 说明一批对象太多，留在ThreadCache中浪费内存
+    void RecordStranded(uint64_t n) {
+        stranded_objects_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // batch不变时tc_slots中除了最后一个都是满的(BatchSize()个对象)，最后一个可以不满；
+    // batch调整之前放入的slot保持原来的大小，直到被取走。
+    // 从最后一个开始取，整个slot接过去是O(1)的，只有拆开一个slot时才要遍历
+    uint64_t TakeFromSlots(FreeList& freelist, uint64_t N) {
+        std::lock_guard<SpinLock> guard(tc_lock_);
+        uint64_t got = 0;
+        while (got < N && cache_used_ > 0) {
+            FreeList& top = tc_slots[cache_used_-1];
+            uint64_t n = top.FreeObjects();
+            if (n <= N - got) {
+                freelist.Splice(top);
+                cache_used_--;
+            } else {
+                n = N - got;
+                top.PopRange(n, freelist);
+            }
+            got += n;
+        }
+        cached_objects_ -= got;
+        return got;
+    }
+
+    // 不满的批次先补满最后一个slot，多出来的放到新的slot。
+    // 超过一批或者没有空slot时返回false，由调用者还给span
+    bool PutToSlots(FreeList& freelist, uint64_t N) {
+        std::lock_guard<SpinLock> guard(tc_lock_);
+        uint64_t batch = BatchSize();
+        if (N > batch) {
+            return false;
+        }
+        uint64_t room = 0;
+        if (cache_used_ > 0 && tc_slots[cache_used_-1].FreeObjects() < batch) {
+            room = batch - tc_slots[cache_used_-1].FreeObjects();
+        }
+        // batch变大时cache_size_会变小，已经用了的slot可能超过cache_size_
+        if (N > room && cache_used_ >= cache_size_) {
+            return false;
+        }
+        if (room > 0) {
+            uint64_t n = N < room ? N : room;
+            freelist.PopRange(n, tc_slots[cache_used_-1]);
+        }
+        if (!freelist.Empty()) {
+            tc_slots[cache_used_].Clear();
+            tc_slots[cache_used_].Splice(freelist);
+            cache_used_++;
+        }
+        cached_objects_ += N;
+        return true;
+    }
+
+    // 后台线程周期性调用：上一次调用时已经空闲的span还给PageHeap，
+    // 这之后空闲的span留到下一次。一直被复用的span不会被归还。
+    // 空闲span缓存关闭之后调用一次就全部归还
+    void ReleaseIdleSpans() {
+        std::lock_guard<std::mutex> guard(lock_);
+        while (!ListEmpty(&idle_old_)) {
+            Span* span = idle_old_.next;
+            ListRemove(span);
+            idle_spans_--;
+            PageHeap::Instance()->Delete(span);
+        }
+        bool enabled = IdleSpanCacheEnabled();
+        while (!ListEmpty(&idle_new_)) {
+            Span* span = idle_new_.next;
+            ListRemove(span);
+            if (enabled) {
+                ListInsert(&idle_old_, span);
+            } else {
+                idle_spans_--;
+                PageHeap::Instance()->Delete(span);
+            }
+        }
+    }
+
+    // 空闲span只有后台线程会归还，所以后台线程运行期间才缓存，
+    // 否则空出来的span直接还给PageHeap。关闭后由ReleaseIdleSpans清空已经缓存的
+    static void SetIdleSpanCache(bool enabled) {
+        idle_cache_enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    static bool IdleSpanCacheEnabled() {
+        return idle_cache_enabled_.load(std::memory_order_relaxed);
+    }
+
+    // 后台线程周期性调用：上一个周期里有从span取对象，并且取完剩下不到一批时，
+    // 提前向PageHeap要一个span放进空闲span缓存，下一次未命中不用等PageHeap。
+    // 没有被用到的span和其他空闲span一样由ReleaseIdleSpans归还。返回是否补充了
+    bool RefillIfLow() {
+        if (!refill_requested_.exchange(false, std::memory_order_relaxed)) {
+            return false;
+        }
+        if (!IdleSpanCacheEnabled()) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            if (free_objects_ >= BatchSize() || idle_spans_ > 0) {
+                return false;
+            }
+        }
+        Span* span = PageHeap::Instance()->New(class_pages_);
+        if (span == nullptr) {
+            return false;
+        }
+        assert(span->npages == class_pages_);
+        PageHeap::Instance()->RegisterSizeClass(span, class_);
+        std::lock_guard<std::mutex> guard(lock_);
+        CacheIdleSpan(span);
+        return true;
+    }
+
+    // span中剩下的对象数，不含tc_slots
+    uint64_t SpanFreeObjects() {
+        std::lock_guard<std::mutex> guard(lock_);
+        return free_objects_;
+    }
+
+    uint64_t IdleSpans() {
+        std::lock_guard<std::mutex> guard(lock_);
+        return idle_spans_;
+    }
+
+    // tc_slots中的对象数
+    uint64_t CachedObjects() {
+        std::lock_guard<SpinLock> guard(tc_lock_);
+        return cached_objects_;
     }
 
     bool CheckState() {
-        assert(cache_used_ <= cache_size_);
-        for (int i = 0; i < cache_used_; ++i) {
-            assert(tc_slots[i].FreeObjects() == num_to_move_);
+        {
+            std::lock_guard<SpinLock> guard(tc_lock_);
+            assert(1 <= cache_size_ && cache_size_ <= kMaxSlots);
+            assert(cache_used_ <= kMaxSlots);
+            assert(min_batch_ <= BatchSize() && BatchSize() <= max_batch_);
+            uint64_t cached = 0;
+            for (int i = 0; i < cache_used_; ++i) {
+                assert(0 < tc_slots[i].FreeObjects() && tc_slots[i].FreeObjects() <= max_batch_);
+                cached += tc_slots[i].FreeObjects();
+            }
+            assert(cached == cached_objects_);
         }
 
         uint64_t span_nums = 0;
@@ -71,81 +248,256 @@ public:
             assert((it)->size_class == class_);
             assert((it)->location == Span::IN_USE);
             assert((it)->refcount > 0);
-            assert((it)->freelist.Empty());
+            assert(!(it)->HasFreeObjects());
             span_nums++;
         }
-        for (Span* it = nonempty_.next; it != &nonempty_; it = it->next) {
-            assert((it)->size_class == class_);
-            assert((it)->location == Span::IN_USE);
-            assert((it)->refcount >= 0);
-            assert(!(it)->freelist.Empty());
-            span_nums++;
-            free_objects += (it)->freelist.FreeObjects();
+        for (int i = 0; i < kOccupancyBuckets; ++i) {
+            for (Span* it = nonempty_[i].next; it != &nonempty_[i]; it = it->next) {
+                assert((it)->size_class == class_);
+                assert((it)->location == Span::IN_USE);
+                assert((it)->refcount >= 0);
+                assert((it)->HasFreeObjects());
+                assert(OccupancyBucket((it)->refcount) == i);
+                span_nums++;
+                free_objects += (it)->FreeObjects();
+            }
         }
         assert(free_objects == free_objects_);
         assert(span_nums == span_nums_);
+
+        uint64_t idle_spans = 0;
+        for (Span* list : {&idle_new_, &idle_old_}) {
+            for (Span* it = list->next; it != list; it = it->next) {
+                assert((it)->size_class == class_);
+                assert((it)->location == Span::IN_USE);
+                assert((it)->refcount == 0);
+                idle_spans++;
+            }
+        }
+        assert(idle_spans == idle_spans_);
+        assert(idle_spans_ <= max_idle_spans_);
         return true;
     }
 
 private:
-    int FetchFromSpans(FreeList& freelist, int N) {
+    static const uint64_t kMaxBatchSize = 128;
+    static const int kMaxSlots = 64;
+    // 每kAdjustInterval次拿lock_评估一次batch大小
+    static const uint64_t kAdjustInterval = 256;
+
+    // 拿不到锁时记一次竞争再阻塞等待
+    std::unique_lock<std::mutex> LockSpans() {
+        std::unique_lock<std::mutex> guard(lock_, std::try_to_lock);
+        if (!guard.owns_lock()) {
+            guard.lock();
+            contended_ops_++;
+        }
+        locked_ops_++;
+        return guard;
+    }
+
+    // 在lock_下调用。tc_slots不够用才会拿lock_，所以拿lock_的次数就是未命中的次数：
+    // 1. lock_上的竞争超过1/8，或者几乎都是取对象(ThreadCache一直未命中，
+    //    对象没有还回来)，batch翻倍，减少拿锁的次数
+    // 2. 否则Scavenge归还的闲置对象超过取走的一半时，batch减半
+    void MaybeAdjustBatchSize() {
+        if (locked_ops_ < kAdjustInterval) {
+            return;
+        }
+        uint64_t stranded = stranded_objects_.exchange(0, std::memory_order_relaxed);
+        uint64_t batch = BatchSize();
+        uint64_t new_batch = batch;
+        if (contended_ops_ * 8 >= locked_ops_ || (fill_ops_ * 8 >= locked_ops_ * 7 && stranded == 0)) {
+            new_batch = std::min(2 * batch, max_batch_);
+        } else if (stranded > 0 && fetched_objects_ > 0 && stranded * 2 >= fetched_objects_) {
+            // 只有归还没有取的窗口里两者都是0，不能据此减半
+            new_batch = std::max(batch / 2, min_batch_);
+        }
+        locked_ops_ = 0;
+        contended_ops_ = 0;
+        fill_ops_ = 0;
+        fetched_objects_ = 0;
+        if (new_batch != batch) {
+            SetBatchSize(new_batch);
+        }
+    }
+
+    // tc_slots最多缓存约1MB，batch变大时slot数相应减少
+    void SetBatchSize(uint64_t batch) {
+        assert(min_batch_ <= batch && batch <= max_batch_);
+        std::lock_guard<SpinLock> guard(tc_lock_);
+        batch_size_.store(batch, std::memory_order_relaxed);
+        cache_size_ = (1024 * 1024) / (class_bytes_ * batch);
+        cache_size_ = std::max(1, cache_size_);
+        cache_size_ = std::min(int(kMaxSlots), cache_size_);
+        assert(1 <= cache_size_ && cache_size_ <= kMaxSlots);
+    }
+
+    // 非空的span按已分配对象的比例分桶，优先从最满的span分配，
+    // 快空的span没有新的分配，对象陆续还回来之后整个还给PageHeap
+    static const int kOccupancyBuckets = 8;
+
+    int OccupancyBucket(uint64_t refcount) {
+        assert(refcount < objects_per_span_);
+        return refcount * kOccupancyBuckets / objects_per_span_;
+    }
+
+    Span* FullestNonempty() {
+        for (int i = kOccupancyBuckets - 1; i >= 0; --i) {
+            if (!ListEmpty(&nonempty_[i])) {
+                return nonempty_[i].next;
+            }
+        }
+        return nullptr;
+    }
+
+    // refcount从old_refcount变化之后，把非空的span移到对应的桶
+    void Rebucket(Span* span, uint64_t old_refcount) {
+        int bucket = OccupancyBucket(span->refcount);
+        if (bucket != OccupancyBucket(old_refcount)) {
+            ListRemove(span);
+            ListInsert(&nonempty_[bucket], span);
+        }
+    }
+
+    // span不够时Populate会暂时放开lock_，调用前后span链表可能被其他线程改变
+    int FetchFromSpans(std::unique_lock<std::mutex>& guard, FreeList& freelist, int N, int owner) {
         int fetched = 0;
-        fetched_nonempty:
-        while (fetched < N && !ListEmpty(&nonempty_)) {
-            Span* span = nonempty_.next;
-            while (fetched < N && !span->freelist.Empty()) {
-                fetched++;
-                span->refcount++;
-                free_objects_--;
-                freelist.PushFront(span->freelist.PopFront());
-            }
-            if (span->freelist.Empty()) {
+        while (fetched < N) {
+            Span* span = FullestNonempty();
+            if (span == nullptr) {
+                // oom，返回已经取到的部分
+                if (!Populate(guard)) {
+                    break;
+                }
+                continue;
+            }
+            uint64_t old_refcount = span->refcount;
+            if (owner >= 0) {
+                __atomic_store_n(&span->owner, owner, __ATOMIC_RELAXED);
+            }
+            // span剩下的对象不超过需要的数量时整个接过去
+            int n = span->FreeObjects();
+            if (n > N - fetched) {
+                n = N - fetched;
+            }
+            span->PopFreeObjects(n, freelist);
+            fetched += n;
+            span->refcount += n;
+            free_objects_ -= n;
+            if (!span->HasFreeObjects()) {
                 RemoveFromList(span);
                 InsertToList(&empty_, span);
+            } else {
+                Rebucket(span, old_refcount);
             }
         }
-        assert(CheckState());
-        if (fetched < N) {
-            Populate();
-            goto fetched_nonempty;
+        if (free_objects_ < BatchSize()) {
+            refill_requested_.store(true, std::memory_order_relaxed);
         }
+        assert(CheckState());
         return fetched;
     }
 
-    void ReleaseToSpans(FreeList& freelist, int N) {
+    // 一批对象通常来自一两个span，连续的属于同一个span的对象只查一次PageMap，
+    // refcount、计数和所在链表也按一段更新一次
+    void ReleaseToSpans(FreeList& freelist) {
         while (!freelist.Empty()) {
             void* ptr = freelist.PopFront();
             Span* span = PageHeap::Instance()->GetSpanFromPageId(Span::PageIdFromPtr(ptr));
             assert(span->location == Span::IN_USE);
             assert(span->size_class == class_);
 
-            if (span->freelist.Empty()) {
-                RemoveFromList(span);
-                InsertToList(&nonempty_, span);
+            uint64_t first_page = span->page_id;
+            uint64_t end_page = span->page_id + span->npages;
+            uint64_t old_refcount = span->refcount;
+            bool had_free = span->HasFreeObjects();
+            uint64_t n = 0;
+            while (true) {
+                span->PushFreeObject(ptr);
+                n++;
+                if (freelist.Empty()) {
+                    break;
+                }
+                uint64_t page = Span::PageIdFromPtr(freelist.Head());
+                if (page < first_page || page >= end_page) {
+                    break;
+                }
+                ptr = freelist.PopFront();
             }
+            assert(n <= old_refcount);
 
-            span->refcount--;
-            free_objects_++;
-            span->freelist.PushFront(ptr);
-
+            span->refcount -= n;
+            free_objects_ += n;
             if (span->refcount == 0) {
-                free_objects_ -= span->freelist.FreeObjects();
+                free_objects_ -= span->FreeObjects();
                 RemoveFromList(span);
-                PageHeap::Instance()->Delete(span);
+                CacheIdleSpan(span);
+            } else if (!had_free) {
+                RemoveFromList(span);
+                InsertToList(&nonempty_[OccupancyBucket(span->refcount)], span);
+            } else {
+                Rebucket(span, old_refcount);
             }
         }
         assert(CheckState());
     }
 
-    void Populate() {
-        Span* span = PageHeap::Instance()->New(class_pages_);
-        assert(span->npages == class_pages_);
-        PageHeap::Instance()->RegisterSizeClass(span, class_);
+    // 刚空出来的span先留在这里，分配释放在span边界附近来回时
+    // 不用每次都经过PageHeap的锁和RegisterSizeClass。
+    // span仍然是IN_USE，PageMap中的class也不变，复用时只需重新初始化
+    void CacheIdleSpan(Span* span) {
+        if (!IdleSpanCacheEnabled() || idle_spans_ >= max_idle_spans_) {
+            PageHeap::Instance()->Delete(span);
+            return;
+        }
+        ListInsert(&idle_new_, span);
+        idle_spans_++;
+    }
+
+    Span* TakeIdleSpan() {
+        for (Span* list : {&idle_new_, &idle_old_}) {
+            if (!ListEmpty(list)) {
+                Span* span = list->next;
+                ListRemove(span);
+                idle_spans_--;
+                return span;
+            }
+        }
+        return nullptr;
+    }
+
+    // 优先复用空闲的span。向PageHeap要span可能要GrowHeap去mmap，
+    // 这期间放开lock_，其他线程照常在这个class上取还对象，拿到span之后再挂上去。
+    // 多个线程同时未命中时可能各自准备一个span，放开锁期间已经有别的span挂上来时
+    // 这个span放进空闲span缓存，没有用到会被ReleaseIdleSpans归还。
+    // PageHeap分配不出span时返回false
+    bool Populate(std::unique_lock<std::mutex>& guard) {
+        assert(guard.owns_lock());
+        Span* span = TakeIdleSpan();
+        if (span == nullptr) {
+            guard.unlock();
+            span = PageHeap::Instance()->New(class_pages_);
+            if (span != nullptr) {
+                assert(span->npages == class_pages_);
+                PageHeap::Instance()->RegisterSizeClass(span, class_);
+            }
+            guard.lock();
+            if (span == nullptr) {
+                return false;
+            }
+            if (FullestNonempty() != nullptr) {
+                CacheIdleSpan(span);
+                return true;
+            }
+        }
+        assert(span->refcount == 0 && span->size_class == class_);
 
         free_objects_ += span->InitFreeList(class_bytes_);
-        assert(span->freelist.FreeObjects() > 0);
-        InsertToList(&nonempty_, span);
+        assert(span->FreeObjects() == objects_per_span_);
+        InsertToList(&nonempty_[0], span);
         assert(CheckState());
+        return true;
     }
 
     void InsertToList(Span* list, Span* span) {
@@ -158,22 +510,52 @@ private:
         ListRemove(span);
     }
 
-    int class_;
-    uint64_t class_pages_;
-    uint64_t class_bytes_;
-    uint64_t num_to_move_;
+    // 所有成员都有初始值，保证central_freelists是常量初始化的
+    int class_ = 0;
+    uint64_t class_pages_ = 0;
+    uint64_t class_bytes_ = 0;
+    uint64_t num_to_move_ = 0;
+    uint64_t min_batch_ = 0;
+    uint64_t max_batch_ = 0;
+    std::atomic<uint64_t> batch_size_{0};
 
+    // 保护下面的span链表和计数
     std::mutex lock_;
-    FreeList tc_slots[64];
-    int cache_size_;
-    int cache_used_;
+    // 调整batch用的统计，由lock_保护
+    uint64_t locked_ops_ = 0;
+    uint64_t contended_ops_ = 0;
+    uint64_t fill_ops_ = 0;
+    uint64_t fetched_objects_ = 0;
+    std::atomic<uint64_t> stranded_objects_{0};
 
-    uint64_t span_nums_;
-    uint64_t free_objects_;
+    // 保护tc_slots和cache_used_，单独占cache line，和lock_不互相干扰
+    alignas(64) SpinLock tc_lock_;
+    int cache_size_ = 0;
+    int cache_used_ = 0;
+    uint64_t cached_objects_ = 0;
+    FreeList tc_slots[kMaxSlots];
+
+    alignas(64) uint64_t span_nums_ = 0;
+    uint64_t free_objects_ = 0;
+    uint64_t objects_per_span_ = 0;
     Span  empty_;
-    Span  nonempty_;
+    Span  nonempty_[kOccupancyBuckets];
+
+    // 每个class缓存的空闲span不超过kIdleSpanBytes，至少一个
+    static const uint64_t kIdleSpanBytes = 128 << 10;
+    uint64_t idle_spans_ = 0;
+    uint64_t max_idle_spans_ = 0;
+    Span  idle_new_;
+    Span  idle_old_;
+
+    // 低于一批的水位时置位，由后台线程补充，见RefillIfLow
+    std::atomic<bool> refill_requested_{false};
+
+    static std::atomic<bool> idle_cache_enabled_;
 };
 
+std::atomic<bool> CentralFreelist::idle_cache_enabled_(false);
+
 }
 
 #endif //TCMALLOC_CENTRAL_FREELIST_HPP
@@ -0,0 +1,605 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#ifndef TCMALLOC_CPU_CACHE_HPP
+#define TCMALLOC_CPU_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/sysinfo.h>
+#if __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#endif
+#if __has_include(<linux/membarrier.h>)
+#include <linux/membarrier.h>
+#endif
+
+#include "size_class.hpp"
+#include "span.hpp"
+#include "spin_lock.hpp"
+#include "system_alloc.hpp"
+#include "thread_cache.hpp"
+
+// x86_64上glibc注册了rseq时，快路径用rseq临界区，不加锁
+#if defined(__x86_64__) && __has_include(<sys/rseq.h>) && __has_include(<linux/membarrier.h>)
+#define TCMALLOC_PERCPU_RSEQ 1
+#else
+#define TCMALLOC_PERCPU_RSEQ 0
+#endif
+
+namespace tcmalloc {
+
+// 每个cpu一个前端缓存，打开之后不再创建ThreadCache，
+// 缓存总量随cpu数而不是线程数增长，适合线程很多的进程。
+//
+// 每个cpu上每个class的缓存是一个指针数组objs[0, length)，最多放capacity个。
+// 快路径在rseq临界区中读当前cpu、改length，提交只有一条store；
+// 线程在临界区内被抢占、迁移或者收到信号时内核让它从头重来，所以不需要锁。
+// 补充、归还和调整capacity走慢路径，由每个cpu的slow_lock串行化，
+// 其中对数组的修改仍然通过rseq的Pop/Push/SetCapacity完成。
+// Clear要修改其他cpu的数组，先设置stopped，再用membarrier打断那个cpu上的临界区。
+//
+// 不是x86_64、glibc没有注册rseq(例如GLIBC_TUNABLES=glibc.pthread.rseq=0)
+// 或者内核不支持membarrier的rseq命令时，退回到每个cpu一个SpinLock保护同样的数组
+class CpuCache {
+public:
+    // 每个cpu最多缓存的字节数，按capacity计算，length不会超过它
+    static const uint64_t kPerCpuCacheSize = 4 << 20;
+
+    void* Alloc(int cl) {
+        assert(0 < cl && cl < kMaxClass);
+        void* ptr = TryPop(cl);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+        return AllocSlow(cl);
+    }
+
+    void Free(void* ptr, int cl) {
+        assert(0 < cl && cl < kMaxClass);
+        if (!TryPush(ptr, cl)) {
+            FreeSlow(ptr, cl);
+        }
+    }
+
+    // 把所有cpu缓存的对象还给CentralFreelist，capacity清零
+    void Clear() {
+        for (int cpu = 0; cpu < kMaxCpus; ++cpu) {
+            PerCpu& c = cpus_[cpu];
+            std::lock_guard<SpinLock> guard(c.slow_lock);
+            if (c.slab == nullptr) {
+                continue;
+            }
+            Stop(cpu);
+            for (int cl = 1; cl < kMaxClass; ++cl) {
+                Header& h = c.headers[cl];
+                uint32_t n = Load(h.length);
+                if (n > 0) {
+                    FreeList fl;
+                    for (uint32_t i = 0; i < n; ++i) {
+                        fl.PushFront(h.objs[i]);
+                    }
+                    Store(h.length, 0);
+                    ThreadCache::Central(cl).ReleaseFreeList(fl, n);
+                }
+                Store(h.capacity, 0);
+            }
+            c.capacity_bytes = 0;
+            Start(cpu);
+        }
+    }
+
+    uint64_t UsedSize() {
+        uint64_t size = 0;
+        for (int cpu = 0; cpu < kMaxCpus; ++cpu) {
+            PerCpu& c = cpus_[cpu];
+            // 没有走过慢路径的cpu上什么也没有
+            if (__atomic_load_n(&c.slab, __ATOMIC_ACQUIRE) == nullptr) {
+                continue;
+            }
+            for (int cl = 1; cl < kMaxClass; ++cl) {
+                size += Load(c.headers[cl].length) * ClassSize(cl);
+            }
+        }
+        return size;
+    }
+
+    static int CurrentCpu() {
+        int cpu = -1;
+#if __has_include(<sys/rseq.h>)
+        if (__rseq_size > 0) {
+            auto* rs = reinterpret_cast<volatile struct rseq *>(
+                    reinterpret_cast<char *>(__builtin_thread_pointer()) + __rseq_offset);
+            cpu = static_cast<int>(rs->cpu_id);
+        }
+#endif
+        if (cpu < 0) {
+            cpu = sched_getcpu();
+        }
+        // cpu超过kMaxCpus时多个cpu共用一个缓存，只在加锁模式下出现
+        return cpu < 0 ? 0 : cpu % kMaxCpus;
+    }
+
+    // 没有调用过SetEnabled时由环境变量TCMALLOC_PER_CPU_CACHES决定
+    static bool Enabled() {
+        int state = enabled_.load(std::memory_order_relaxed);
+        if (state < 0) {
+            const char* env = getenv("TCMALLOC_PER_CPU_CACHES");
+            state = (env != nullptr && env[0] == '1') ? 1 : 0;
+            // 先初始化CentralFreelist和rseq再发布状态
+            if (state == 1) {
+                ThreadCache::InitGlobalMaybe();
+                RseqSupported();
+            }
+            int expected = -1;
+            enabled_.compare_exchange_strong(expected, state, std::memory_order_relaxed);
+            state = enabled_.load(std::memory_order_relaxed);
+        }
+        return state == 1;
+    }
+
+    // 切换模式是安全的：两种前端都只和CentralFreelist交换对象，
+    // 一个前端分配的对象可以释放到另一个前端
+    static void SetEnabled(bool enabled) {
+        if (enabled) {
+            ThreadCache::InitGlobalMaybe();
+            RseqSupported();
+        }
+        enabled_.store(enabled ? 1 : 0, std::memory_order_relaxed);
+    }
+
+    // 快路径是否使用rseq
+    static bool UseRseq() {
+        return use_rseq_.load(std::memory_order_relaxed);
+    }
+
+    // 测试用：在rseq和加锁之间切换，两种模式用同样的数组。
+    // 只能在没有其他线程使用CpuCache时调用。返回切换之后是否使用rseq
+    static bool SetUseRseq(bool enabled) {
+        use_rseq_.store(enabled && RseqSupported(), std::memory_order_relaxed);
+        return UseRseq();
+    }
+
+    static CpuCache* Instance() {
+        static CpuCache cpu_cache;
+        return &cpu_cache;
+    }
+
+private:
+    static const int kMaxCpus = 256;
+    static const uint64_t kPerClassCacheBytes = 256 << 10;
+    static const int kMaxPerClassLength = 2048;
+
+    struct Header {
+        uint32_t length;
+        uint32_t capacity;
+        void** objs;
+    };
+
+    // 按cache line对齐，相邻cpu不会伪共享。
+    // rseq临界区按偏移访问stopped和headers，stopped必须是第一个字段
+    struct alignas(64) PerCpu {
+        uint32_t stopped = 0;
+        Header headers[kMaxClass] = {};
+        // 加锁模式下保护headers
+        SpinLock lock;
+        // 保护capacity的调整、capacity_bytes和slab的分配
+        SpinLock slow_lock;
+        void** slab = nullptr;
+        uint64_t capacity_bytes = 0;
+        // 超过kPerCpuCacheSize时下一个缩小capacity的class
+        int next_victim = 1;
+    };
+
+    static uint32_t Load(const uint32_t& v) {
+        return __atomic_load_n(&v, __ATOMIC_RELAXED);
+    }
+
+    static void Store(uint32_t& v, uint32_t x) {
+        __atomic_store_n(&v, x, __ATOMIC_RELAXED);
+    }
+
+    static uint64_t HeaderOffset(int cl) {
+        return offsetof(PerCpu, headers) + cl * sizeof(Header);
+    }
+
+    // 每个class的capacity上限：最多kPerClassCacheBytes字节，至少两个最大的batch
+    static uint32_t MaxCapacity(int cl) {
+        uint64_t length = kPerClassCacheBytes / ClassSize(cl);
+        if (length > kMaxPerClassLength) {
+            length = kMaxPerClassLength;
+        }
+        return std::max<uint64_t>(length, 2 * ThreadCache::Central(cl).MaxBatchSize());
+    }
+
+#if TCMALLOC_PERCPU_RSEQ
+// rseq临界区从标签1开始，提交的store之后是标签2。
+// 设置rseq_cs的store紧挨着标签1，在它之前被抢占时内核只是清掉rseq_cs，
+// 所以abort之后回到标签7重新设置rseq_cs，再重新读cpu。
+// abort入口之前4字节必须是glibc注册时用的RSEQ_SIG
+#define TCMALLOC_RSEQ_BEGIN                                     \
+        ".pushsection __rseq_cs, \"aw\"\n\t"                    \
+        ".balign 32\n\t"                                        \
+        "3:\n\t"                                                \
+        ".long 0x0, 0x0\n\t"                                    \
+        ".quad 1f, (2f - 1f), 4f\n\t"                           \
+        ".popsection\n\t"                                       \
+        "7:\n\t"                                                \
+        "leaq 3b(%%rip), %%rax\n\t"                             \
+        "movq %%rax, %%fs:%c[rseq_cs](%[rseq_offset])\n\t"      \
+        "1:\n\t"                                                \
+        "movl %%fs:%c[cpu_id](%[rseq_offset]), %%eax\n\t"
+
+#define TCMALLOC_RSEQ_ABORT                                     \
+        ".pushsection __rseq_failure, \"ax\"\n\t"               \
+        ".byte 0x0f, 0xb9, 0x3d\n\t"                            \
+        ".long 0x53053053\n\t"                                  \
+        "4:\n\t"                                                \
+        "jmp 7b\n\t"                                            \
+        ".popsection\n\t"
+
+// 由cpu号得到PerCpu，stopped时失败，否则rax指向class的Header
+#define TCMALLOC_RSEQ_HEADER                                    \
+        "imulq %[stride], %%rax\n\t"                            \
+        "addq %[cpus], %%rax\n\t"                               \
+        "cmpl $0, (%%rax)\n\t"                                  \
+        "jne 5f\n\t"                                            \
+        "addq %[header], %%rax\n\t"
+
+#define TCMALLOC_RSEQ_OPERANDS                                  \
+        [rseq_offset] "r"(__rseq_offset),                       \
+        [cpus] "r"(cpus_),                                      \
+        [header] "r"(HeaderOffset(cl)),                         \
+        [rseq_cs] "i"(offsetof(struct rseq, rseq_cs)),          \
+        [cpu_id] "i"(offsetof(struct rseq, cpu_id)),            \
+        [stride] "i"(sizeof(PerCpu))
+
+    // 从当前cpu取一个对象，空或者stopped时返回nullptr
+    void* RseqPop(int cl) {
+        void* result;
+        __asm__ __volatile__(
+                TCMALLOC_RSEQ_BEGIN
+                TCMALLOC_RSEQ_HEADER
+                "movl (%%rax), %%ecx\n\t"
+                "testl %%ecx, %%ecx\n\t"
+                "jz 5f\n\t"
+                "decl %%ecx\n\t"
+                "movq 8(%%rax), %%rdx\n\t"
+                "movq (%%rdx,%%rcx,8), %[result]\n\t"
+                "movl %%ecx, (%%rax)\n\t"
+                "2:\n\t"
+                "jmp 6f\n\t"
+                "5:\n\t"
+                "xorl %k[result], %k[result]\n\t"
+                "6:\n\t"
+                TCMALLOC_RSEQ_ABORT
+                : [result] "=&r"(result)
+                : TCMALLOC_RSEQ_OPERANDS
+                : "rax", "rcx", "rdx", "memory", "cc");
+        return result;
+    }
+
+    // 放一个对象到当前cpu，满了或者stopped时返回false
+    bool RseqPush(void* ptr, int cl) {
+        int ok;
+        __asm__ __volatile__(
+                TCMALLOC_RSEQ_BEGIN
+                TCMALLOC_RSEQ_HEADER
+                "movl (%%rax), %%ecx\n\t"
+                "cmpl 4(%%rax), %%ecx\n\t"
+                "jae 5f\n\t"
+                "movq 8(%%rax), %%rdx\n\t"
+                "movq %[ptr], (%%rdx,%%rcx,8)\n\t"
+                "incl %%ecx\n\t"
+                "movl %%ecx, (%%rax)\n\t"
+                "2:\n\t"
+                "movl $1, %k[ok]\n\t"
+                "jmp 6f\n\t"
+                "5:\n\t"
+                "xorl %k[ok], %k[ok]\n\t"
+                "6:\n\t"
+                TCMALLOC_RSEQ_ABORT
+                : [ok] "=&r"(ok)
+                : [ptr] "r"(ptr), TCMALLOC_RSEQ_OPERANDS
+                : "rax", "rcx", "rdx", "memory", "cc");
+        return ok != 0;
+    }
+
+    // 当前cpu是cpu并且length不超过capacity时把capacity改为capacity
+    bool RseqSetCapacity(int cpu, int cl, uint32_t capacity) {
+        int ok;
+        __asm__ __volatile__(
+                TCMALLOC_RSEQ_BEGIN
+                "cmpl %k[cpu], %%eax\n\t"
+                "jne 5f\n\t"
+                TCMALLOC_RSEQ_HEADER
+                "cmpl %k[capacity], (%%rax)\n\t"
+                "ja 5f\n\t"
+                "movl %k[capacity], 4(%%rax)\n\t"
+                "2:\n\t"
+                "movl $1, %k[ok]\n\t"
+                "jmp 6f\n\t"
+                "5:\n\t"
+                "xorl %k[ok], %k[ok]\n\t"
+                "6:\n\t"
+                TCMALLOC_RSEQ_ABORT
+                : [ok] "=&r"(ok)
+                : [cpu] "r"(cpu), [capacity] "r"(capacity), TCMALLOC_RSEQ_OPERANDS
+                : "rax", "rcx", "rdx", "memory", "cc");
+        return ok != 0;
+    }
+
+#undef TCMALLOC_RSEQ_BEGIN
+#undef TCMALLOC_RSEQ_ABORT
+#undef TCMALLOC_RSEQ_HEADER
+#undef TCMALLOC_RSEQ_OPERANDS
+#endif
+
+    void* TryPop(int cl) {
+#if TCMALLOC_PERCPU_RSEQ
+        if (UseRseq()) {
+            return RseqPop(cl);
+        }
+#endif
+        PerCpu& c = cpus_[CurrentCpu()];
+        std::lock_guard<SpinLock> guard(c.lock);
+        Header& h = c.headers[cl];
+        uint32_t n = Load(h.length);
+        if (n == 0) {
+            return nullptr;
+        }
+        Store(h.length, n - 1);
+        return h.objs[n - 1];
+    }
+
+    bool TryPush(void* ptr, int cl) {
+#if TCMALLOC_PERCPU_RSEQ
+        if (UseRseq()) {
+            return RseqPush(ptr, cl);
+        }
+#endif
+        PerCpu& c = cpus_[CurrentCpu()];
+        std::lock_guard<SpinLock> guard(c.lock);
+        Header& h = c.headers[cl];
+        uint32_t n = Load(h.length);
+        if (n >= Load(h.capacity)) {
+            return false;
+        }
+        h.objs[n] = ptr;
+        Store(h.length, n + 1);
+        return true;
+    }
+
+    // 缩小cpu上cl的capacity，length超过新的capacity时失败。
+    // rseq模式下只能改当前cpu，线程已经迁移到其他cpu时也失败
+    bool SetCapacity(int cpu, int cl, uint32_t capacity) {
+#if TCMALLOC_PERCPU_RSEQ
+        if (UseRseq()) {
+            return RseqSetCapacity(cpu, cl, capacity);
+        }
+#endif
+        PerCpu& c = cpus_[cpu];
+        std::lock_guard<SpinLock> guard(c.lock);
+        Header& h = c.headers[cl];
+        if (Load(h.length) > capacity) {
+            return false;
+        }
+        Store(h.capacity, capacity);
+        return true;
+    }
+
+    // Stop之后到Start之前，cpu上不会有Pop/Push/SetCapacity成功，
+    // 调用者可以直接修改它的headers。要在slow_lock下调用
+    void Stop(int cpu) {
+        PerCpu& c = cpus_[cpu];
+#if TCMALLOC_PERCPU_RSEQ
+        if (UseRseq()) {
+            __atomic_store_n(&c.stopped, 1, __ATOMIC_SEQ_CST);
+            // 打断cpu上正在执行的临界区，重来时会看到stopped。
+            // 被抢占的线程恢复运行时本来就会重来
+            if (syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED_RSEQ, MEMBARRIER_CMD_FLAG_CPU, cpu) != 0) {
+                syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED_RSEQ, 0, 0);
+            }
+            return;
+        }
+#endif
+        c.lock.lock();
+    }
+
+    void Start(int cpu) {
+        PerCpu& c = cpus_[cpu];
+#if TCMALLOC_PERCPU_RSEQ
+        if (UseRseq()) {
+            __atomic_store_n(&c.stopped, 0, __ATOMIC_RELEASE);
+            return;
+        }
+#endif
+        c.lock.unlock();
+    }
+
+    // 第一次调用时检查rseq和membarrier，支持时打开rseq模式
+    static bool RseqSupported() {
+        int state = rseq_state_.load(std::memory_order_acquire);
+        if (state < 0) {
+            state = 0;
+#if TCMALLOC_PERCPU_RSEQ
+            if (__rseq_size > 0 && get_nprocs_conf() <= kMaxCpus &&
+                syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED_RSEQ, 0, 0) == 0) {
+                state = 1;
+            }
+#endif
+            int expected = -1;
+            if (rseq_state_.compare_exchange_strong(expected, state, std::memory_order_acq_rel)) {
+                use_rseq_.store(state == 1, std::memory_order_relaxed);
+            }
+            state = rseq_state_.load(std::memory_order_acquire);
+        }
+        return state == 1;
+    }
+
+    // 第一次在这个cpu上走慢路径时分配对象数组，按每个class的capacity上限划分
+    bool EnsureSlab(PerCpu& c) {
+        if (c.slab != nullptr) {
+            return true;
+        }
+        uint64_t slots = 0;
+        for (int cl = 1; cl < kMaxClass; ++cl) {
+            slots += MaxCapacity(cl);
+        }
+        void* slab = SystemAlloc(slots * sizeof(void*));
+        if (slab == MAP_FAILED) {
+            return false;
+        }
+        void** objs = static_cast<void**>(slab);
+        for (int cl = 1; cl < kMaxClass; ++cl) {
+            c.headers[cl].objs = objs;
+            objs += MaxCapacity(cl);
+        }
+        // objs对其他cpu上的临界区可见之后capacity才会变大
+        __atomic_store_n(&c.slab, static_cast<void**>(slab), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    void* AllocSlow(int cl) {
+        int cpu = CurrentCpu();
+        PerCpu& c = cpus_[cpu];
+        std::lock_guard<SpinLock> guard(c.slow_lock);
+        CentralFreelist& central = ThreadCache::Central(cl);
+        FreeList fl;
+        if (!EnsureSlab(c)) {
+            return central.FillFreeList(fl, 1) == 1 ? fl.PopFront() : nullptr;
+        }
+        // 等锁期间其他线程可能已经补充过了
+        void* ptr = TryPop(cl);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+        int fetched = central.FillFreeList(fl, central.BatchSize());
+        // oom
+        if (fetched == 0) {
+            return nullptr;
+        }
+        Grow(c, cpu, cl, fetched - 1);
+        ptr = fl.PopFront();
+        PushOrRelease(fl, cl);
+        return ptr;
+    }
+
+    void FreeSlow(void* ptr, int cl) {
+        int cpu = CurrentCpu();
+        PerCpu& c = cpus_[cpu];
+        std::lock_guard<SpinLock> guard(c.slow_lock);
+        CentralFreelist& central = ThreadCache::Central(cl);
+        uint64_t batch = central.BatchSize();
+        if (EnsureSlab(c)) {
+            if (TryPush(ptr, cl)) {
+                return;
+            }
+            if (Grow(c, cpu, cl, batch) > 0 && TryPush(ptr, cl)) {
+                return;
+            }
+        }
+        // capacity已经到上限，连同这个对象还一批给CentralFreelist
+        FreeList fl;
+        fl.PushFront(ptr);
+        while (static_cast<uint64_t>(fl.FreeObjects()) < batch) {
+            void* obj = TryPop(cl);
+            if (obj == nullptr) {
+                break;
+            }
+            fl.PushFront(obj);
+        }
+        central.ReleaseFreeList(fl, fl.FreeObjects());
+    }
+
+    void PushOrRelease(FreeList& fl, int cl) {
+        while (!fl.Empty()) {
+            void* obj = fl.PopFront();
+            if (!TryPush(obj, cl)) {
+                fl.PushFront(obj);
+                ThreadCache::Central(cl).ReleaseFreeList(fl, fl.FreeObjects());
+                return;
+            }
+        }
+    }
+
+    // cl的capacity最多增加want，返回实际增加的数量。
+    // 超过kPerCpuCacheSize时轮流缩小其他class的capacity，
+    // 只缩小当前class的话其他class占着的容量永远不会被回收
+    uint32_t Grow(PerCpu& c, int cpu, int cl, uint64_t want) {
+        uint32_t capacity = Load(c.headers[cl].capacity);
+        uint64_t target = std::min<uint64_t>(MaxCapacity(cl), capacity + want);
+        if (target <= capacity) {
+            return 0;
+        }
+        uint64_t need = (target - capacity) * ClassSize(cl);
+        for (int i = 0; i < kMaxClass && c.capacity_bytes + need > kPerCpuCacheSize; ++i) {
+            int victim = c.next_victim;
+            c.next_victim = victim + 1 < kMaxClass ? victim + 1 : 1;
+            if (victim != cl) {
+                Shrink(c, cpu, victim, c.capacity_bytes + need - kPerCpuCacheSize);
+            }
+        }
+        if (c.capacity_bytes + need > kPerCpuCacheSize) {
+            // 其他class腾不出来，只增加放得下的部分
+            uint64_t room = kPerCpuCacheSize > c.capacity_bytes ? kPerCpuCacheSize - c.capacity_bytes : 0;
+            target = capacity + room / ClassSize(cl);
+            if (target <= capacity) {
+                return 0;
+            }
+            need = (target - capacity) * ClassSize(cl);
+        }
+        __atomic_store_n(&c.headers[cl].capacity, static_cast<uint32_t>(target), __ATOMIC_RELEASE);
+        c.capacity_bytes += need;
+        return target - capacity;
+    }
+
+    // 从victim腾出至少bytes字节的capacity：先把超出新capacity的对象还给CentralFreelist，
+    // 再缩小capacity。期间有对象放进来或者线程迁移到其他cpu时放弃这一次
+    void Shrink(PerCpu& c, int cpu, int victim, uint64_t bytes) {
+        Header& h = c.headers[victim];
+        uint32_t capacity = Load(h.capacity);
+        if (capacity == 0) {
+            return;
+        }
+        uint64_t size = ClassSize(victim);
+        uint32_t k = std::min<uint64_t>(capacity, (bytes + size - 1) / size);
+        uint32_t new_capacity = capacity - k;
+        FreeList fl;
+        while (Load(h.length) > new_capacity) {
+            void* obj = TryPop(victim);
+            if (obj == nullptr) {
+                break;
+            }
+            fl.PushFront(obj);
+        }
+        if (!fl.Empty()) {
+            ThreadCache::Central(victim).ReleaseFreeList(fl, fl.FreeObjects());
+        }
+        if (SetCapacity(cpu, victim, new_capacity)) {
+            c.capacity_bytes -= k * size;
+        }
+    }
+
+    PerCpu cpus_[kMaxCpus];
+
+    static std::atomic<int> enabled_;
+    // -1未检查，0不支持rseq，1支持
+    static std::atomic<int> rseq_state_;
+    static std::atomic<bool> use_rseq_;
+};
+
+std::atomic<int> CpuCache::enabled_(-1);
+std::atomic<int> CpuCache::rseq_state_(-1);
+std::atomic<bool> CpuCache::use_rseq_(false);
+
+}
+
+#endif //TCMALLOC_CPU_CACHE_HPP
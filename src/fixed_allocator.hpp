@@ -15,10 +15,10 @@ namespace tcmalloc {
 template<class T>
 class FixedAllocator {
 public:
-    FixedAllocator() {
-        construct = true;
-        assert(!inited);
-    }
+    // constexpr构造保证静态对象在任何动态初始化之前就绪，
+    // 作为LD_PRELOAD的malloc时，其他库的构造函数可能先于本库调用malloc
+    constexpr FixedAllocator()
+        : area_(nullptr), area_free_(0), freelist_(nullptr), inited(false), construct(true) {}
     T *Alloc() {
         if (!inited) {
             assert(construct);
@@ -83,8 +83,8 @@ private:
     uint64_t area_free_;
     void *freelist_;
 
-    bool inited = false;
-    bool construct = false;
+    bool inited;
+    bool construct;
 };
 
 
@@ -0,0 +1,221 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+// 导出libc的malloc系列函数和operator new/delete，
+// 链接或者LD_PRELOAD libtcmalloc.so之后所有分配都走tcmalloc。
+
+#include <cerrno>
+#include <cstdlib>
+#include <malloc.h>
+#include <unistd.h>
+#include <new>
+
+#include "tcmalloc.h"
+
+#define TCMALLOC_EXPORT __attribute__((visibility("default")))
+
+namespace {
+
+    // 分配失败时按照C++标准反复调用new_handler，
+    // 没有new_handler时抛出std::bad_alloc或者返回nullptr。
+    // align为0表示默认对齐
+    void* CppAlloc(size_t size, size_t align, bool nothrow) {
+        for (;;) {
+            void* ptr = align == 0 ? tcmalloc::malloc(size) : tcmalloc::memalign(align, size);
+            if (ptr != nullptr) {
+                return ptr;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr) {
+                if (nothrow) return nullptr;
+                throw std::bad_alloc();
+            }
+            if (nothrow) {
+                try {
+                    handler();
+                } catch (const std::bad_alloc&) {
+                    return nullptr;
+                }
+            } else {
+                handler();
+            }
+        }
+    }
+
+    void* AlignedAlloc(size_t align, size_t size) {
+        void* ptr = tcmalloc::memalign(align, size);
+        if (ptr == nullptr) {
+            errno = ENOMEM;
+        }
+        return ptr;
+    }
+
+}
+
+extern "C" {
+
+TCMALLOC_EXPORT void* malloc(size_t size) __THROW {
+    void* ptr = tcmalloc::malloc(size);
+    if (ptr == nullptr) {
+        errno = ENOMEM;
+    }
+    return ptr;
+}
+
+TCMALLOC_EXPORT void free(void* ptr) __THROW {
+    tcmalloc::free(ptr);
+}
+
+// C23
+TCMALLOC_EXPORT void free_sized(void* ptr, size_t size) {
+    tcmalloc::free_sized(ptr, size);
+}
+
+// C23
+TCMALLOC_EXPORT void free_aligned_sized(void* ptr, size_t align, size_t size) {
+    tcmalloc::free_aligned_sized(ptr, align, size);
+}
+
+TCMALLOC_EXPORT void cfree(void* ptr) __THROW {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void* calloc(size_t n, size_t size) __THROW {
+    void* ptr = tcmalloc::calloc(n, size);
+    if (ptr == nullptr) {
+        errno = ENOMEM;
+    }
+    return ptr;
+}
+
+TCMALLOC_EXPORT void* realloc(void* ptr, size_t size) __THROW {
+    void* new_ptr = tcmalloc::realloc(ptr, size);
+    if (new_ptr == nullptr && size != 0) {
+        errno = ENOMEM;
+    }
+    return new_ptr;
+}
+
+TCMALLOC_EXPORT void* memalign(size_t align, size_t size) __THROW {
+    if (align == 0 || (align & (align - 1)) != 0) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    return AlignedAlloc(align, size);
+}
+
+TCMALLOC_EXPORT void* aligned_alloc(size_t align, size_t size) __THROW {
+    return memalign(align, size);
+}
+
+TCMALLOC_EXPORT int posix_memalign(void** result, size_t align, size_t size) __THROW {
+    if (align == 0 || (align & (align - 1)) != 0 || align % sizeof(void*) != 0) {
+        return EINVAL;
+    }
+    void* ptr = tcmalloc::memalign(align, size);
+    if (ptr == nullptr) {
+        return ENOMEM;
+    }
+    *result = ptr;
+    return 0;
+}
+
+TCMALLOC_EXPORT void* valloc(size_t size) __THROW {
+    return AlignedAlloc(getpagesize(), size);
+}
+
+TCMALLOC_EXPORT void* pvalloc(size_t size) __THROW {
+    size_t pagesize = getpagesize();
+    size = (size + pagesize - 1) & ~(pagesize - 1);
+    return AlignedAlloc(pagesize, size == 0 ? pagesize : size);
+}
+
+TCMALLOC_EXPORT size_t malloc_usable_size(void* ptr) __THROW {
+    return tcmalloc::usable_size(ptr);
+}
+
+}
+
+TCMALLOC_EXPORT void* operator new(size_t size) {
+    return CppAlloc(size, 0, false);
+}
+
+TCMALLOC_EXPORT void* operator new[](size_t size) {
+    return CppAlloc(size, 0, false);
+}
+
+TCMALLOC_EXPORT void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return CppAlloc(size, 0, true);
+}
+
+TCMALLOC_EXPORT void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return CppAlloc(size, 0, true);
+}
+
+TCMALLOC_EXPORT void operator delete(void* ptr) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    tcmalloc::free(ptr);
+}
+
+#if defined(__cpp_sized_deallocation)
+TCMALLOC_EXPORT void operator delete(void* ptr, size_t size) noexcept {
+    tcmalloc::free_sized(ptr, size);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr, size_t size) noexcept {
+    tcmalloc::free_sized(ptr, size);
+}
+#endif
+
+#if defined(__cpp_aligned_new)
+TCMALLOC_EXPORT void* operator new(size_t size, std::align_val_t align) {
+    return CppAlloc(size, static_cast<size_t>(align), false);
+}
+
+TCMALLOC_EXPORT void* operator new[](size_t size, std::align_val_t align) {
+    return CppAlloc(size, static_cast<size_t>(align), false);
+}
+
+TCMALLOC_EXPORT void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return CppAlloc(size, static_cast<size_t>(align), true);
+}
+
+TCMALLOC_EXPORT void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return CppAlloc(size, static_cast<size_t>(align), true);
+}
+
+TCMALLOC_EXPORT void operator delete(void* ptr, std::align_val_t) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr, std::align_val_t) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    tcmalloc::free(ptr);
+}
+
+TCMALLOC_EXPORT void operator delete(void* ptr, size_t size, std::align_val_t align) noexcept {
+    tcmalloc::free_aligned_sized(ptr, static_cast<size_t>(align), size);
+}
+
+TCMALLOC_EXPORT void operator delete[](void* ptr, size_t size, std::align_val_t align) noexcept {
+    tcmalloc::free_aligned_sized(ptr, static_cast<size_t>(align), size);
+}
+#endif
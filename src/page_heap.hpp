@@ -30,6 +30,9 @@ public:
         release_index_ = 0;
         release_rate_ = 100;
 
+        const char* env = getenv("TCMALLOC_HUGEPAGE");
+        hugepage_aware_ = (env != nullptr && env[0] == '1');
+
         for (int i = 0; i <= spanSmallPages; ++i) {
             ListInit(&small_normal_[i]);
             ListInit(&small_returned_[i]);
@@ -38,6 +41,11 @@ public:
 
     Span* New(uint64_t n) {
         std::lock_guard<std::mutex> guard(lock);
+        // 大页模式下大的span从大页边界开始，独占它覆盖的大页，
+        // 最后一个大页中剩下的部分留给小span
+        if (hugepage_aware_ && n >= kHugePagePages) {
+            return NewAlignedLocked(n, kHugePagePages);
+        }
         Span* span = nullptr;
         span = SearchSmallAndLarge(n);
         if (span != nullptr) {
@@ -64,6 +72,81 @@ public:
         return nullptr;
     }
 
+    // 分配首页按align_pages对齐的n页，align_pages必须是2的幂。
+    // 多找align_pages-1页，把头部不对齐的部分切回空闲链表
+    Span* NewAligned(uint64_t n, uint64_t align_pages) {
+        assert((align_pages & (align_pages - 1)) == 0);
+        if (align_pages <= 1) {
+            return New(n);
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        return NewAlignedLocked(n, align_pages);
+    }
+
+    // 大页模式：GrowHeap按2MB对齐并MADV_HUGEPAGE，大span独占整个大页，
+    // 小span优先从没有归还过的内存中切，紧凑地放在尽量少的大页里，
+    // 只归还完整空闲的大页，不拆散透明大页。
+    // 默认关闭，也可以设置环境变量TCMALLOC_HUGEPAGE=1打开。
+    // 切换只影响之后的GrowHeap，之前映射的内存仍然不按大页对齐。
+    // huge_normal_只在大页模式下维护，打开时从large_normal_重建
+    void SetHugePageAware(bool enabled) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (enabled == hugepage_aware_) {
+            return;
+        }
+        hugepage_aware_ = enabled;
+        huge_normal_.clear();
+        if (enabled) {
+            for (Span* span : large_normal_) {
+                if (HasWholeHugePage(span)) {
+                    huge_normal_.insert(span);
+                }
+            }
+        }
+    }
+
+    bool HugePageAware() {
+        std::lock_guard<std::mutex> guard(lock);
+        return hugepage_aware_;
+    }
+
+    // 原地把使用中的span调整为n页。缩小时尾部切回空闲链表；
+    // 扩大时像MergePrevAndNextSpans一样通过page_map_找到紧邻的下一个span，
+    // 它空闲且足够大时吞并需要的部分。无法原地扩大时返回false
+    bool Resize(Span* span, uint64_t n) {
+        std::lock_guard<std::mutex> guard(lock);
+        assert(span->location == Span::IN_USE);
+        assert(span->size_class == 0);
+        assert(n > 0);
+        if (n == span->npages) {
+            return true;
+        }
+        if (n < span->npages) {
+            uint64_t extra = span->npages - n;
+            Span* tail = NewSpan(span->page_id + n, extra);
+            // oom
+            assert(tail != nullptr);
+            span->npages = n;
+            SetPageMap(span->page_id + n - 1, span);
+            SetPageMap(tail->page_id, tail);
+            SetPageMap(tail->page_id + extra - 1, tail);
+            tail->location = Span::IN_USE;
+            MergeIntoFreeList(tail);
+            return true;
+        }
+
+        Span* next = reinterpret_cast<Span *>(page_map_.Get(span->page_id + span->npages));
+        if (next == nullptr || next->location == Span::IN_USE ||
+            span->npages + next->npages < n) {
+            return false;
+        }
+        RemoveFromFreeList(next);
+        next = Carve(next, n - span->npages);
+        MergeSpanToPrev(span, next);
+        assert(CheckSmallList());
+        return true;
+    }
+
     void Delete(Span* span) {
         std::lock_guard<std::mutex> guard(lock);
         span->size_class = 0;
@@ -77,7 +160,7 @@ public:
         assert(page_map_.Get(span->page_id + span->npages - 1) == span);
         span->size_class = sc;
         for (int i = 1; i < span->npages - 1; ++i) {
-            assert(page_map_.Set(span->page_id + i, span));
+            SetPageMap(span->page_id + i, span);
         }
     }
 
@@ -121,8 +204,13 @@ public:
         }
 
         int count = large_normal_.size();
+        uint64_t huge_count = 0;
         for (auto it = large_normal_.begin(); it != large_normal_.end(); ++it) {
             count--;
+            if (hugepage_aware_ && HasWholeHugePage(*it)) {
+                assert(huge_normal_.count(*it) == 1);
+                huge_count++;
+            }
             assert(count >= 0);
             assert((*it)->location == Span::IN_NORMAL);
             assert(page_map_.Get((*it)->page_id) == (*it));
@@ -130,6 +218,7 @@ public:
             normal_bytes += (*it)->npages * spanPageSize;
             large_normal_bytes += (*it)->npages * spanPageSize;
         }
+        assert(huge_count == huge_normal_.size());
         count = large_returned_.size();
         for (auto it = large_returned_.begin(); it != large_returned_.end(); ++it) {
             count--;
@@ -149,16 +238,46 @@ public:
         return true;
     }
 
+    // 不使用函数内静态对象：它的析构函数要通过__cxa_atexit注册，
+    // 而__cxa_atexit可能调用calloc，作为libc的malloc时会递归回这里
     static PageHeap* Instance() {
-        static PageHeap page_heap;
-        return &page_heap;
+        alignas(PageHeap) static char storage[sizeof(PageHeap)];
+        static PageHeap* page_heap = new (storage) PageHeap();
+        return page_heap;
     }
 
     PageHeap(const PageHeap&) = delete;
     PageHeap& operator=(const PageHeap&) = delete;
 private:
+    // Set放在assert里的话，定义NDEBUG编译时PageMap不会被更新
+    void SetPageMap(uint64_t page_id, Span* span) {
+        bool ok = page_map_.Set(page_id, span);
+        assert(ok);
+        (void)ok;
+    }
+
+
+    Span* NewAlignedLocked(uint64_t n, uint64_t align_pages) {
+        uint64_t search = n + align_pages - 1;
+        Span* span = SearchSmallAndLarge(search);
+        if (span == nullptr && GrowHeap(search)) {
+            span = SearchSmallAndLarge(search);
+        }
+        if (span == nullptr) {
+            return nullptr;
+        }
+        uint64_t skip = (align_pages - span->page_id % align_pages) % align_pages;
+        if (skip > 0) {
+            span = CarveHead(span, skip);
+        }
+        assert(span->page_id % align_pages == 0);
+        return Carve(span, n);
+    }
 
     Span* SearchSmallAndLarge(uint64_t n) {
+        if (hugepage_aware_) {
+            return SearchNormalFirst(n);
+        }
         Span* span = nullptr;
         for (uint64_t i = n; i <= spanSmallPages; ++i) {
             if (!ListEmpty(&small_normal_[i])) {
@@ -178,21 +297,48 @@ private:
         return AllocLarge(n);
     }
 
-    Span* AllocLarge(uint64_t n) {
+    // 大页模式下归还过的内存都是完整的大页，先在没有归还过的内存中找，
+    // 小span挤在已经被占用的大页里，归还过的大页尽量保持空闲
+    Span* SearchNormalFirst(uint64_t n) {
+        Span* span = nullptr;
+        for (uint64_t i = n; i <= spanSmallPages && span == nullptr; ++i) {
+            if (!ListEmpty(&small_normal_[i])) {
+                span = small_normal_[i].next;
+            }
+        }
+        if (span == nullptr) {
+            span = BestFit(large_normal_, n);
+        }
+        for (uint64_t i = n; i <= spanSmallPages && span == nullptr; ++i) {
+            if (!ListEmpty(&small_returned_[i])) {
+                span = small_returned_[i].next;
+            }
+        }
+        if (span == nullptr) {
+            span = BestFit(large_returned_, n);
+        }
+        if (span != nullptr) {
+            RemoveFromFreeList(span);
+        }
+        assert(CheckSmallList());
+        return span;
+    }
+
+    // set中不少于n页的最小的span
+    Span* BestFit(SpanSet& set, uint64_t n) {
         Span bound;
         bound.npages = n;
         bound.page_id = 0;
-        Span* best = nullptr;
-
-        auto it_normal = large_normal_.upper_bound(&bound);
-        if (it_normal != large_normal_.end()) {
-            best = *it_normal;
-        }
+        auto it = set.upper_bound(&bound);
+        return it == set.end() ? nullptr : *it;
+    }
 
-        auto it_returned = large_returned_.upper_bound(&bound);
-        if (it_returned != large_returned_.end()) {
-            if (best == nullptr || best->npages > (*it_returned)->npages) {
-                best = *it_returned;
+    Span* AllocLarge(uint64_t n) {
+        Span* best = BestFit(large_normal_, n);
+        Span* returned = BestFit(large_returned_, n);
+        if (returned != nullptr) {
+            if (best == nullptr || best->npages > returned->npages) {
+                best = returned;
             }
         }
 
@@ -208,6 +354,7 @@ private:
         assert(span->location == Span::IN_USE);
         stat.in_used_bytes -= span->npages * spanPageSize;
         span->location = Span::IN_NORMAL;
+        span->zeroed = false;
 
         // 尝试合并相邻span
         assert(CheckSmallList());
@@ -243,25 +390,80 @@ private:
         span->npages = n;
         // oom
         assert(new_span != nullptr);
-        assert(page_map_.Set(span->page_id + n - 1, span));
-        assert(page_map_.Set(new_span->page_id, new_span));
-        assert(page_map_.Set(new_span->page_id + extra -1, new_span));
+        SetPageMap(span->page_id + n - 1, span);
+        SetPageMap(new_span->page_id, new_span);
+        SetPageMap(new_span->page_id + extra -1, new_span);
 
         new_span->location = old_location;
+        new_span->zeroed = span->zeroed;
         InsertToFreeList(new_span);
         stat.in_used_bytes += span->npages * spanPageSize;
         assert(CheckSmallList());
         return span;
     }
 
+    // 把span的前n页切成新的span放回空闲链表，返回剩下的部分，
+    // span必须已经从空闲链表中取出
+    Span* CarveHead(Span* span, uint64_t n) {
+        assert(span->location != Span::IN_USE);
+        assert(n < span->npages);
+        Span* head = NewSpan(span->page_id, n);
+        // oom
+        assert(head != nullptr);
+        span->page_id += n;
+        span->npages -= n;
+        SetPageMap(head->page_id, head);
+        SetPageMap(head->page_id + n - 1, head);
+        SetPageMap(span->page_id, span);
+
+        head->location = span->location;
+        head->zeroed = span->zeroed;
+        InsertToFreeList(head);
+        assert(CheckSmallList());
+        return span;
+    }
+
+    // 把span的后n页切成新的span放回空闲链表，返回剩下的部分，
+    // span必须已经从空闲链表中取出
+    Span* CarveTail(Span* span, uint64_t n) {
+        assert(span->location != Span::IN_USE);
+        assert(n < span->npages);
+        Span* tail = NewSpan(span->page_id + span->npages - n, n);
+        // oom
+        assert(tail != nullptr);
+        span->npages -= n;
+        SetPageMap(tail->page_id, tail);
+        SetPageMap(tail->page_id + n - 1, tail);
+        SetPageMap(span->page_id + span->npages - 1, span);
+
+        tail->location = span->location;
+        tail->zeroed = span->zeroed;
+        InsertToFreeList(tail);
+        assert(CheckSmallList());
+        return span;
+    }
+
     bool GrowHeap(uint64_t n) {
+        // 下面按页和大页取整不能回绕
+        if (n > (UINT64_MAX - kHugePageSize) / spanPageSize) {
+            return false;
+        }
         uint64_t alloc_size = n * spanPageSize;
         if (alloc_size < kSystemAlloc) {
             alloc_size = kSystemAlloc;
         }
         // 按页对齐
         alloc_size = ((alloc_size+spanPageSize-1)/spanPageSize)*spanPageSize;
-        void* ptr = SystemAlloc(alloc_size);
+        void* ptr;
+        if (hugepage_aware_) {
+            alloc_size = ((alloc_size+kHugePageSize-1)/kHugePageSize)*kHugePageSize;
+            ptr = SystemAllocAligned(alloc_size, kHugePageSize);
+            if (ptr != (void*)(-1)) {
+                SystemHugePage(ptr, alloc_size);
+            }
+        } else {
+            ptr = SystemAlloc(alloc_size);
+        }
         if (ptr == (void*)(-1)) {
             return false;
         }
@@ -269,16 +471,20 @@ private:
 
         Span* span = NewSpan((uint64_t)ptr/spanPageSize, alloc_size/spanPageSize);
         assert(span != nullptr);
-        assert(page_map_.Set(span->page_id, span));
-        assert(page_map_.Set(span->page_id + span->npages -1, span));
+        SetPageMap(span->page_id, span);
+        SetPageMap(span->page_id + span->npages -1, span);
 
         span->location = Span::IN_NORMAL;
+        span->zeroed = true;
         InsertToFreeList(span);
         assert(CheckSmallList());
         return true;
     }
 
     uint64_t ReleaseNormalSpans(uint64_t npages) {
+        if (hugepage_aware_) {
+            return ReleaseHugePages(npages);
+        }
         uint64_t released_pages = 0;
         while ( released_pages < npages && stat.normal_bytes > 0 ) {
             release_index_++;
@@ -301,17 +507,56 @@ private:
         return released_pages;
     }
 
+    // 只在包含完整大页的span中找，没有可以归还的大页时不用扫描。
+    // 从小的开始，最近释放的碎片先归还，刚GrowHeap的大块内存最后才动
+    uint64_t ReleaseHugePages(uint64_t npages) {
+        uint64_t released_pages = 0;
+        auto it = huge_normal_.begin();
+        while (released_pages < npages && it != huge_normal_.end()) {
+            Span* span = *it;
+            ++it;
+            // span从set中删除，剩下的头尾都不满一个大页，不会插回huge_normal_
+            released_pages += ReleaseSpan(span);
+        }
+        assert(CheckSmallList());
+        return released_pages;
+    }
+
+    // span是否包含一个按大页对齐的完整大页
+    static bool HasWholeHugePage(Span* span) {
+        uint64_t begin = (span->page_id + kHugePagePages - 1) / kHugePagePages * kHugePagePages;
+        return begin + kHugePagePages <= span->page_id + span->npages;
+    }
+
+    // 大页模式只归还span中完整的大页，头尾不满一个大页的部分仍然是normal
     uint64_t ReleaseSpan(Span* span) {
         assert(span->location == Span::IN_NORMAL);
+        uint64_t begin = span->page_id;
+        uint64_t end = span->page_id + span->npages;
+        if (hugepage_aware_) {
+            begin = (begin + kHugePagePages - 1) / kHugePagePages * kHugePagePages;
+            end = end / kHugePagePages * kHugePagePages;
+            if (begin >= end) {
+                return 0;
+            }
+        }
         if (!SystemRelease(
-                reinterpret_cast<void *>(span->page_id * spanPageSize),
-                span->npages * spanPageSize))
+                reinterpret_cast<void *>(begin * spanPageSize),
+                (end - begin) * spanPageSize))
         {
             return 0;
         }
-        uint64_t old_pages = span->npages;
         RemoveFromFreeList(span);
+        if (begin > span->page_id) {
+            span = CarveHead(span, begin - span->page_id);
+        }
+        if (end < span->page_id + span->npages) {
+            span = CarveTail(span, span->page_id + span->npages - end);
+        }
+        uint64_t old_pages = span->npages;
+        assert(old_pages == end - begin);
         span->location = Span::IN_RETURNED;
+        span->zeroed = true;
         assert(CheckSmallList());
         span = MergePrevAndNextSpans(span);
         assert(CheckSmallList());
@@ -337,16 +582,18 @@ private:
 
     Span* MergeSpanToPrev(Span* prev, Span* next) {
         prev->npages += next->npages;
+        prev->zeroed = prev->zeroed && next->zeroed;
         DeleteSpan(next);
-        assert(page_map_.Set(prev->page_id + prev->npages - 1, prev));
+        SetPageMap(prev->page_id + prev->npages - 1, prev);
         return prev;
     }
 
     Span* MergeSpanToNext(Span* prev, Span* next) {
         next->page_id -= prev->npages;
         next->npages += prev->npages;
+        next->zeroed = prev->zeroed && next->zeroed;
         DeleteSpan(prev);
-        assert(page_map_.Set(next->page_id, next));
+        SetPageMap(next->page_id, next);
         return next;
     }
 
@@ -368,6 +615,9 @@ private:
                 auto result = large_normal_.insert(span);
                 // page_id不可能重复
                 assert(result.second);
+                if (hugepage_aware_ && HasWholeHugePage(span)) {
+                    huge_normal_.insert(span);
+                }
                 stat.large_normal_bytes += span->npages * spanPageSize;
             } else {
                 auto result = large_returned_.insert(span);
@@ -401,6 +651,9 @@ private:
             if (span->location == Span::IN_NORMAL) {
                 stat.large_normal_bytes -= span->npages * spanPageSize;
                 large_normal_.erase(span);
+                if (hugepage_aware_ && HasWholeHugePage(span)) {
+                    huge_normal_.erase(span);
+                }
             } else {
                 stat.large_returned_bytes -= span->npages * spanPageSize;
                 large_returned_.erase(span);
@@ -463,9 +716,12 @@ private:
     static const uint64_t spanPageSize = Span::spanPageSize;
     static const uint64_t spanSmallPages = 127;
     static const uint64_t kSystemAlloc = 1024 * 1024 *1024;
+    static const uint64_t kHugePageSize = 2 * 1024 * 1024;
+    static const uint64_t kHugePagePages = kHugePageSize / spanPageSize;
 
     uint64_t release_index_;
     int64_t release_rate_;
+    bool hugepage_aware_;
 
     std::mutex lock;
 
@@ -478,6 +734,9 @@ private:
     // pages >= 128
     SpanSet large_normal_;
     SpanSet large_returned_;
+    // large_normal_中包含完整大页的span，大页模式归还时只看这些，
+    // 默认模式下为空
+    SpanSet huge_normal_;
 
     // page_id -> span
     PageMap page_map_;
@@ -0,0 +1,143 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#ifndef TCMALLOC_REMOTE_FREE_HPP
+#define TCMALLOC_REMOTE_FREE_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <sched.h>
+
+#include "size_class.hpp"
+
+namespace tcmalloc {
+
+// 跨线程释放。生产者线程分配、消费者线程释放时，消费者的ThreadCache
+// 堆满用不到的对象，不停地ListTooLong还给CentralFreelist，生产者又不停地
+// 从CentralFreelist取，两边在CentralFreelist的锁上来回争抢。
+// 打开之后，span记录最近从它取对象的线程(owner)，其他线程释放这个span的对象时
+// 无锁地压入owner的队列，owner的链表空了之后先一次取走整个队列，再找CentralFreelist。
+// 队列只有压入和整体取走两种操作，不存在ABA问题。
+// 每个owner的队列最多kMaxQueuedBytes字节，owner不再从某个class分配时
+// 队列也不会无限增长；owner在Scavenge、空闲和退出时都会取走队列。
+class RemoteFree {
+public:
+    static const int kMaxOwners = 256;
+    static const uint64_t kMaxQueuedBytes = 1 << 20;
+
+    // owner死亡或者队列满了返回false，由调用者按普通释放处理
+    static bool Push(int owner, int cl, void* ptr) {
+        assert(0 <= owner && owner < kMaxOwners);
+        assert(0 < cl && cl < kMaxClass);
+        Owner& o = owners_[owner];
+        // 先登记再检查alive，RetireOwner先清除alive再等pushers归零，
+        // 两边都是seq_cst，owner退出时压入成功的对象都已经在队列里
+        o.pushers.fetch_add(1);
+        bool pushed = false;
+        if (o.alive.load()) {
+            uint64_t bytes = ClassSize(cl);
+            if (o.queued_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes > kMaxQueuedBytes) {
+                o.queued_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            } else {
+                std::atomic<void*>& head = o.heads[cl];
+                void* old_head = head.load(std::memory_order_relaxed);
+                do {
+                    *(reinterpret_cast<void **>(ptr)) = old_head;
+                } while (!head.compare_exchange_weak(old_head, ptr, std::memory_order_release,
+                                                     std::memory_order_relaxed));
+                pushed = true;
+            }
+        }
+        o.pushers.fetch_sub(1, std::memory_order_release);
+        return pushed;
+    }
+
+    // 取走owner队列中cl的所有对象，返回链表头
+    static void* TakeAll(int owner, int cl) {
+        assert(0 <= owner && owner < kMaxOwners);
+        std::atomic<void*>& head = owners_[owner].heads[cl];
+        // 队列多数时候是空的，先读一次避免无谓的写
+        if (head.load(std::memory_order_relaxed) == nullptr) {
+            return nullptr;
+        }
+        return head.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    // owner取走队列之后调用，bytes是取到的对象的总字节数
+    static void Consumed(int owner, uint64_t bytes) {
+        owners_[owner].queued_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    static uint64_t QueuedBytes(int owner) {
+        return owners_[owner].queued_bytes.load(std::memory_order_relaxed);
+    }
+
+    // 以下三个函数由调用者在ThreadCache的global_lock下调用，
+    // 槽位用完时返回-1，这个线程不接收其他线程释放的对象
+    static int AcquireOwner() {
+        for (int i = 0; i < kMaxOwners; ++i) {
+            if (!used_[i]) {
+                assert(owners_[i].queued_bytes.load(std::memory_order_relaxed) == 0);
+                used_[i] = true;
+                owners_[i].alive.store(true, std::memory_order_relaxed);
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // 先停止接收，等正在压入的线程结束，调用者取走队列中剩下的对象之后再ReleaseOwner
+    static void RetireOwner(int owner) {
+        Owner& o = owners_[owner];
+        o.alive.store(false);
+        while (o.pushers.load() != 0) {
+            sched_yield();
+        }
+    }
+
+    static void ReleaseOwner(int owner) {
+        assert(!owners_[owner].alive.load(std::memory_order_relaxed));
+        used_[owner] = false;
+    }
+
+    // 没有调用过SetEnabled时由环境变量TCMALLOC_REMOTE_FREE决定
+    static bool Enabled() {
+        int state = enabled_.load(std::memory_order_relaxed);
+        if (state < 0) {
+            const char* env = getenv("TCMALLOC_REMOTE_FREE");
+            state = (env != nullptr && env[0] == '1') ? 1 : 0;
+            int expected = -1;
+            enabled_.compare_exchange_strong(expected, state, std::memory_order_relaxed);
+            state = enabled_.load(std::memory_order_relaxed);
+        }
+        return state == 1;
+    }
+
+    // 随时可以切换：关闭后队列中已有的对象仍由owner取走
+    static void SetEnabled(bool enabled) {
+        enabled_.store(enabled ? 1 : 0, std::memory_order_relaxed);
+    }
+
+private:
+    // 按cache line对齐，不同owner的队列不会伪共享
+    struct alignas(64) Owner {
+        std::atomic<bool> alive{false};
+        // 正在Push的线程数
+        std::atomic<int> pushers{0};
+        std::atomic<uint64_t> queued_bytes{0};
+        std::atomic<void*> heads[kMaxClass] = {};
+    };
+
+    static Owner owners_[kMaxOwners];
+    static bool used_[kMaxOwners];
+    static std::atomic<int> enabled_;
+};
+
+RemoteFree::Owner RemoteFree::owners_[RemoteFree::kMaxOwners];
+bool RemoteFree::used_[RemoteFree::kMaxOwners];
+std::atomic<int> RemoteFree::enabled_(-1);
+
+}
+
+#endif //TCMALLOC_REMOTE_FREE_HPP
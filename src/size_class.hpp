@@ -10,125 +10,9 @@
 #include <cstddef>
 #include <cassert>
 
-namespace tcmalloc {
-
-    struct SizeClassInfo {
-        size_t size;
-        size_t pages;
-        size_t num_to_move;
-    };
-
-    static const int kMaxSize = 256 * 1024;
-
-    static const int kMaxSmallSize = 1024;
-
-    static const int kMaxClass = 86;
-
-    static const int kMaxSizeToClass = ((kMaxSize + 127 + (120 << 7)) >> 7) + 1;
+#include "tcmalloc_size_class.h"
 
-    // 为了IndexToClass能正确的按对齐分配槽位
-    // 1. <= 1024的对象至少按8字节对齐（size_to_class每8字节分配一个槽位）
-    // 2. > 1024的对象至少按128字节对齐（size_to_class每128字节分配一个槽位）
-    constexpr static const SizeClassInfo SizeClasses[kMaxClass] = {
-            // <bytes>, <pages>, <batch size>    <fixed>
-            {        0,       0,           0},  // +Inf%
-            {        8,       1,          32},  // 0.59%
-            {       16,       1,          32},  // 0.59%
-            {       32,       1,          32},  // 0.59%
-            {       48,       1,          32},  // 0.98%
-            {       64,       1,          32},  // 0.59%
-            {       80,       1,          32},  // 0.98%
-            {       96,       1,          32},  // 0.98%
-            {      112,       1,          32},  // 0.78%
-            {      128,       1,          32},  // 0.59%
-            {      144,       1,          32},  // 2.18%
-            {      160,       1,          32},  // 0.98%
-            {      176,       1,          32},  // 1.78%
-            {      192,       1,          32},  // 2.18%
-            {      208,       1,          32},  // 1.58%
-            {      224,       1,          32},  // 2.18%
-            {      240,       1,          32},  // 0.98%
-            {      256,       1,          32},  // 0.59%
-            {      272,       1,          32},  // 0.98%
-            {      288,       1,          32},  // 2.18%
-            {      304,       1,          32},  // 4.25%
-            {      320,       1,          32},  // 3.00%
-            {      336,       1,          32},  // 2.18%
-            {      352,       1,          32},  // 1.78%
-            {      368,       1,          32},  // 1.78%
-            {      384,       1,          32},  // 2.18%
-            {      400,       1,          32},  // 3.00%
-            {      416,       1,          32},  // 4.25%
-            {      448,       1,          32},  // 2.18%
-            {      480,       1,          32},  // 0.98%
-            {      512,       1,          32},  // 0.59%
-            {      576,       1,          32},  // 2.18%
-            {      640,       1,          32},  // 7.29%
-            {      704,       1,          32},  // 6.40%
-            {      768,       1,          32},  // 7.29%
-            {      896,       1,          32},  // 2.18%
-            {     1024,       1,          32},  // 0.59%
-            {     1152,       2,          32},  // 1.88%
-            {     1280,       2,          32},  // 6.98%
-            {     1408,       2,          32},  // 6.10%
-            {     1536,       2,          32},  // 6.98%
-            {     1792,       2,          32},  // 1.88%
-            {     2048,       2,          32},  // 0.29%
-            {     2304,       2,          28},  // 1.88%
-            {     2688,       2,          24},  // 1.88%
-            {     2816,       3,          23},  // 9.30%
-            {     3200,       2,          20},  // 2.70%
-            {     3456,       3,          18},  // 1.79%
-            {     3584,       4,          18},  // 1.74%
-            {     4096,       1,          16},  // 0.29%
-            {     4736,       3,          13},  // 3.99%
-            {     5376,       2,          12},  // 1.88%
-            {     6144,       3,          10},  // 0.20%
-            {     6528,       4,          10},  // 0.54%
-            {     6784,       5,           9},  // 0.75%
-            {     7168,       7,           9},  // 0.08%
-            {     8192,       1,           8},  // 0.29%
-            {     9472,       5,           6},  // 8.23%
-            {    10240,       4,           6},  // 6.82%
-            {    12288,       3,           5},  // 0.20%
-            {    13568,       5,           4},  // 0.75%
-            {    14336,       7,           4},  // 0.08%
-            {    16384,       2,           4},  // 0.29%
-            {    20480,       5,           3},  // 0.12%
-            {    24576,       3,           2},  // 0.20%
-            {    28672,       7,           2},  // 0.08%
-            {    32768,       4,           2},  // 0.15%
-            {    40960,       5,           2},  // 0.12%
-            {    49152,       6,           2},  // 0.10%
-            {    57344,       7,           2},  // 0.08%
-            {    65536,       8,           2},  // 0.07%
-            {    73728,       9,           2},  // 0.07%
-            {    81920,      10,           2},  // 0.06%
-            {    90112,      11,           2},  // 0.05%
-            {    98304,      12,           2},  // 0.05%
-            {   106496,      13,           2},  // 0.05%
-            {   114688,      14,           2},  // 0.04%
-            {   122880,      15,           2},  // 0.04%
-            {   131072,      16,           2},  // 0.04%
-            {   139264,      17,           2},  // 0.03%
-            {   155648,      19,           2},  // 0.03%
-            {   172032,      21,           2},  // 0.03%
-            {   188416,      23,           2},  // 0.03%
-            {   204800,      25,           2},  // 0.02%
-            {   229376,      28,           2},  // 0.02%
-            {   262144,      32,           2},  // 0.02%
-    };
-
-
-    // <= 1024的对象每8字节分配一个槽位
-    static inline size_t SmallSizeClass(size_t s) {
-        return (static_cast<uint32_t>(s) + 7) >> 3;
-    }
-
-    // > 1024的对象每128字节分配一个槽位
-    static inline size_t LargeSizeClass(size_t s) {
-        return (static_cast<uint32_t>(s) + 127 + (120 << 7)) >> 7;
-    }
+namespace tcmalloc {
 
     // 将s对齐到IndexToClass的槽位
     static inline size_t ClassIndex(size_t s) {
@@ -141,19 +25,6 @@ namespace tcmalloc {
         }
     }
 
-    // 将s对齐到IndexToClass的槽位，大于kMaxSize时返回false
-    // 返回false说明s属于大对象，没有对应的class
-    static inline bool ClassIndexMaybe(size_t s, uint32_t* idx) {
-        if (s <= kMaxSmallSize) {
-            *idx = SmallSizeClass(s);
-            return true;
-        } else if (s <= kMaxSize) {
-            *idx = LargeSizeClass(s);
-            return true;
-        }
-        return false;
-    }
-
     // print=true打印index_to_class数组
     static void PrintIndexToClassArray(bool print) {
         if (print) {
@@ -178,2202 +49,13 @@ namespace tcmalloc {
         }
     }
 
-
-    uint64_t ClassSize(int cl) {
-        return SizeClasses[cl].size;
-    }
-
-    uint64_t ClassPages(int cl) {
+    static constexpr inline uint64_t ClassPages(int cl) {
         return SizeClasses[cl].pages;
     }
 
-    uint64_t ClassToMove(int cl) {
+    static constexpr inline uint64_t ClassToMove(int cl) {
         return SizeClasses[cl].num_to_move;
     }
-
-    // 0bytes时当成8bytes处理，
-    // 不要使用0号class，tcmalloc.cpp要用0来区分大小对象
-    static const int IndexToClass[kMaxSizeToClass] = {
-            // <class> <index>, <bytes>, <class>
-            1,    //    0    0    1
-            1,    //    1    8    1
-            2,    //    2    16    2
-            3,    //    3    24    3
-            3,    //    4    32    3
-            4,    //    5    40    4
-            4,    //    6    48    4
-            5,    //    7    56    5
-            5,    //    8    64    5
-            6,    //    9    72    6
-            6,    //    10    80    6
-            7,    //    11    88    7
-            7,    //    12    96    7
-            8,    //    13    104    8
-            8,    //    14    112    8
-            9,    //    15    120    9
-            9,    //    16    128    9
-            10,    //    17    136    10
-            10,    //    18    144    10
-            11,    //    19    152    11
-            11,    //    20    160    11
-            12,    //    21    168    12
-            12,    //    22    176    12
-            13,    //    23    184    13
-            13,    //    24    192    13
-            14,    //    25    200    14
-            14,    //    26    208    14
-            15,    //    27    216    15
-            15,    //    28    224    15
-            16,    //    29    232    16
-            16,    //    30    240    16
-            17,    //    31    248    17
-            17,    //    32    256    17
-            18,    //    33    264    18
-            18,    //    34    272    18
-            19,    //    35    280    19
-            19,    //    36    288    19
-            20,    //    37    296    20
-            20,    //    38    304    20
-            21,    //    39    312    21
-            21,    //    40    320    21
-            22,    //    41    328    22
-            22,    //    42    336    22
-            23,    //    43    344    23
-            23,    //    44    352    23
-            24,    //    45    360    24
-            24,    //    46    368    24
-            25,    //    47    376    25
-            25,    //    48    384    25
-            26,    //    49    392    26
-            26,    //    50    400    26
-            27,    //    51    408    27
-            27,    //    52    416    27
-            28,    //    53    424    28
-            28,    //    54    432    28
-            28,    //    55    440    28
-            28,    //    56    448    28
-            29,    //    57    456    29
-            29,    //    58    464    29
-            29,    //    59    472    29
-            29,    //    60    480    29
-            30,    //    61    488    30
-            30,    //    62    496    30
-            30,    //    63    504    30
-            30,    //    64    512    30
-            31,    //    65    520    31
-            31,    //    66    528    31
-            31,    //    67    536    31
-            31,    //    68    544    31
-            31,    //    69    552    31
-            31,    //    70    560    31
-            31,    //    71    568    31
-            31,    //    72    576    31
-            32,    //    73    584    32
-            32,    //    74    592    32
-            32,    //    75    600    32
-            32,    //    76    608    32
-            32,    //    77    616    32
-            32,    //    78    624    32
-            32,    //    79    632    32
-            32,    //    80    640    32
-            33,    //    81    648    33
-            33,    //    82    656    33
-            33,    //    83    664    33
-            33,    //    84    672    33
-            33,    //    85    680    33
-            33,    //    86    688    33
-            33,    //    87    696    33
-            33,    //    88    704    33
-            34,    //    89    712    34
-            34,    //    90    720    34
-            34,    //    91    728    34
-            34,    //    92    736    34
-            34,    //    93    744    34
-            34,    //    94    752    34
-            34,    //    95    760    34
-            34,    //    96    768    34
-            35,    //    97    776    35
-            35,    //    98    784    35
-            35,    //    99    792    35
-            35,    //    100    800    35
-            35,    //    101    808    35
-            35,    //    102    816    35
-            35,    //    103    824    35
-            35,    //    104    832    35
-            35,    //    105    840    35
-            35,    //    106    848    35
-            35,    //    107    856    35
-            35,    //    108    864    35
-            35,    //    109    872    35
-            35,    //    110    880    35
-            35,    //    111    888    35
-            35,    //    112    896    35
-            36,    //    113    904    36
-            36,    //    114    912    36
-            36,    //    115    920    36
-            36,    //    116    928    36
-            36,    //    117    936    36
-            36,    //    118    944    36
-            36,    //    119    952    36
-            36,    //    120    960    36
-            36,    //    121    968    36
-            36,    //    122    976    36
-            36,    //    123    984    36
-            36,    //    124    992    36
-            36,    //    125    1000    36
-            36,    //    126    1008    36
-            36,    //    127    1016    36
-            36,    //    128    1024    36
-            37,    //    129    1032    37
-            38,    //    130    1160    38
-            39,    //    131    1288    39
-            40,    //    132    1416    40
-            41,    //    133    1544    41
-            41,    //    134    1672    41
-            42,    //    135    1800    42
-            42,    //    136    1928    42
-            43,    //    137    2056    43
-            43,    //    138    2184    43
-            44,    //    139    2312    44
-            44,    //    140    2440    44
-            44,    //    141    2568    44
-            45,    //    142    2696    45
-            46,    //    143    2824    46
-            46,    //    144    2952    46
-            46,    //    145    3080    46
-            47,    //    146    3208    47
-            47,    //    147    3336    47
-            48,    //    148    3464    48
-            49,    //    149    3592    49
-            49,    //    150    3720    49
-            49,    //    151    3848    49
-            49,    //    152    3976    49
-            50,    //    153    4104    50
-            50,    //    154    4232    50
-            50,    //    155    4360    50
-            50,    //    156    4488    50
-            50,    //    157    4616    50
-            51,    //    158    4744    51
-            51,    //    159    4872    51
-            51,    //    160    5000    51
-            51,    //    161    5128    51
-            51,    //    162    5256    51
-            52,    //    163    5384    52
-            52,    //    164    5512    52
-            52,    //    165    5640    52
-            52,    //    166    5768    52
-            52,    //    167    5896    52
-            52,    //    168    6024    52
-            53,    //    169    6152    53
-            53,    //    170    6280    53
-            53,    //    171    6408    53
-            54,    //    172    6536    54
-            54,    //    173    6664    54
-            55,    //    174    6792    55
-            55,    //    175    6920    55
-            55,    //    176    7048    55
-            56,    //    177    7176    56
-            56,    //    178    7304    56
-            56,    //    179    7432    56
-            56,    //    180    7560    56
-            56,    //    181    7688    56
-            56,    //    182    7816    56
-            56,    //    183    7944    56
-            56,    //    184    8072    56
-            57,    //    185    8200    57
-            57,    //    186    8328    57
-            57,    //    187    8456    57
-            57,    //    188    8584    57
-            57,    //    189    8712    57
-            57,    //    190    8840    57
-            57,    //    191    8968    57
-            57,    //    192    9096    57
-            57,    //    193    9224    57
-            57,    //    194    9352    57
-            58,    //    195    9480    58
-            58,    //    196    9608    58
-            58,    //    197    9736    58
-            58,    //    198    9864    58
-            58,    //    199    9992    58
-            58,    //    200    10120    58
-            59,    //    201    10248    59
-            59,    //    202    10376    59
-            59,    //    203    10504    59
-            59,    //    204    10632    59
-            59,    //    205    10760    59
-            59,    //    206    10888    59
-            59,    //    207    11016    59
-            59,    //    208    11144    59
-            59,    //    209    11272    59
-            59,    //    210    11400    59
-            59,    //    211    11528    59
-            59,    //    212    11656    59
-            59,    //    213    11784    59
-            59,    //    214    11912    59
-            59,    //    215    12040    59
-            59,    //    216    12168    59
-            60,    //    217    12296    60
-            60,    //    218    12424    60
-            60,    //    219    12552    60
-            60,    //    220    12680    60
-            60,    //    221    12808    60
-            60,    //    222    12936    60
-            60,    //    223    13064    60
-            60,    //    224    13192    60
-            60,    //    225    13320    60
-            60,    //    226    13448    60
-            61,    //    227    13576    61
-            61,    //    228    13704    61
-            61,    //    229    13832    61
-            61,    //    230    13960    61
-            61,    //    231    14088    61
-            61,    //    232    14216    61
-            62,    //    233    14344    62
-            62,    //    234    14472    62
-            62,    //    235    14600    62
-            62,    //    236    14728    62
-            62,    //    237    14856    62
-            62,    //    238    14984    62
-            62,    //    239    15112    62
-            62,    //    240    15240    62
-            62,    //    241    15368    62
-            62,    //    242    15496    62
-            62,    //    243    15624    62
-            62,    //    244    15752    62
-            62,    //    245    15880    62
-            62,    //    246    16008    62
-            62,    //    247    16136    62
-            62,    //    248    16264    62
-            63,    //    249    16392    63
-            63,    //    250    16520    63
-            63,    //    251    16648    63
-            63,    //    252    16776    63
-            63,    //    253    16904    63
-            63,    //    254    17032    63
-            63,    //    255    17160    63
-            63,    //    256    17288    63
-            63,    //    257    17416    63
-            63,    //    258    17544    63
-            63,    //    259    17672    63
-            63,    //    260    17800    63
-            63,    //    261    17928    63
-            63,    //    262    18056    63
-            63,    //    263    18184    63
-            63,    //    264    18312    63
-            63,    //    265    18440    63
-            63,    //    266    18568    63
-            63,    //    267    18696    63
-            63,    //    268    18824    63
-            63,    //    269    18952    63
-            63,    //    270    19080    63
-            63,    //    271    19208    63
-            63,    //    272    19336    63
-            63,    //    273    19464    63
-            63,    //    274    19592    63
-            63,    //    275    19720    63
-            63,    //    276    19848    63
-            63,    //    277    19976    63
-            63,    //    278    20104    63
-            63,    //    279    20232    63
-            63,    //    280    20360    63
-            64,    //    281    20488    64
-            64,    //    282    20616    64
-            64,    //    283    20744    64
-            64,    //    284    20872    64
-            64,    //    285    21000    64
-            64,    //    286    21128    64
-            64,    //    287    21256    64
-            64,    //    288    21384    64
-            64,    //    289    21512    64
-            64,    //    290    21640    64
-            64,    //    291    21768    64
-            64,    //    292    21896    64
-            64,    //    293    22024    64
-            64,    //    294    22152    64
-            64,    //    295    22280    64
-            64,    //    296    22408    64
-            64,    //    297    22536    64
-            64,    //    298    22664    64
-            64,    //    299    22792    64
-            64,    //    300    22920    64
-            64,    //    301    23048    64
-            64,    //    302    23176    64
-            64,    //    303    23304    64
-            64,    //    304    23432    64
-            64,    //    305    23560    64
-            64,    //    306    23688    64
-            64,    //    307    23816    64
-            64,    //    308    23944    64
-            64,    //    309    24072    64
-            64,    //    310    24200    64
-            64,    //    311    24328    64
-            64,    //    312    24456    64
-            65,    //    313    24584    65
-            65,    //    314    24712    65
-            65,    //    315    24840    65
-            65,    //    316    24968    65
-            65,    //    317    25096    65
-            65,    //    318    25224    65
-            65,    //    319    25352    65
-            65,    //    320    25480    65
-            65,    //    321    25608    65
-            65,    //    322    25736    65
-            65,    //    323    25864    65
-            65,    //    324    25992    65
-            65,    //    325    26120    65
-            65,    //    326    26248    65
-            65,    //    327    26376    65
-            65,    //    328    26504    65
-            65,    //    329    26632    65
-            65,    //    330    26760    65
-            65,    //    331    26888    65
-            65,    //    332    27016    65
-            65,    //    333    27144    65
-            65,    //    334    27272    65
-            65,    //    335    27400    65
-            65,    //    336    27528    65
-            65,    //    337    27656    65
-            65,    //    338    27784    65
-            65,    //    339    27912    65
-            65,    //    340    28040    65
-            65,    //    341    28168    65
-            65,    //    342    28296    65
-            65,    //    343    28424    65
-            65,    //    344    28552    65
-            66,    //    345    28680    66
-            66,    //    346    28808    66
-            66,    //    347    28936    66
-            66,    //    348    29064    66
-            66,    //    349    29192    66
-            66,    //    350    29320    66
-            66,    //    351    29448    66
-            66,    //    352    29576    66
-            66,    //    353    29704    66
-            66,    //    354    29832    66
-            66,    //    355    29960    66
-            66,    //    356    30088    66
-            66,    //    357    30216    66
-            66,    //    358    30344    66
-            66,    //    359    30472    66
-            66,    //    360    30600    66
-            66,    //    361    30728    66
-            66,    //    362    30856    66
-            66,    //    363    30984    66
-            66,    //    364    31112    66
-            66,    //    365    31240    66
-            66,    //    366    31368    66
-            66,    //    367    31496    66
-            66,    //    368    31624    66
-            66,    //    369    31752    66
-            66,    //    370    31880    66
-            66,    //    371    32008    66
-            66,    //    372    32136    66
-            66,    //    373    32264    66
-            66,    //    374    32392    66
-            66,    //    375    32520    66
-            66,    //    376    32648    66
-            67,    //    377    32776    67
-            67,    //    378    32904    67
-            67,    //    379    33032    67
-            67,    //    380    33160    67
-            67,    //    381    33288    67
-            67,    //    382    33416    67
-            67,    //    383    33544    67
-            67,    //    384    33672    67
-            67,    //    385    33800    67
-            67,    //    386    33928    67
-            67,    //    387    34056    67
-            67,    //    388    34184    67
-            67,    //    389    34312    67
-            67,    //    390    34440    67
-            67,    //    391    34568    67
-            67,    //    392    34696    67
-            67,    //    393    34824    67
-            67,    //    394    34952    67
-            67,    //    395    35080    67
-            67,    //    396    35208    67
-            67,    //    397    35336    67
-            67,    //    398    35464    67
-            67,    //    399    35592    67
-            67,    //    400    35720    67
-            67,    //    401    35848    67
-            67,    //    402    35976    67
-            67,    //    403    36104    67
-            67,    //    404    36232    67
-            67,    //    405    36360    67
-            67,    //    406    36488    67
-            67,    //    407    36616    67
-            67,    //    408    36744    67
-            67,    //    409    36872    67
-            67,    //    410    37000    67
-            67,    //    411    37128    67
-            67,    //    412    37256    67
-            67,    //    413    37384    67
-            67,    //    414    37512    67
-            67,    //    415    37640    67
-            67,    //    416    37768    67
-            67,    //    417    37896    67
-            67,    //    418    38024    67
-            67,    //    419    38152    67
-            67,    //    420    38280    67
-            67,    //    421    38408    67
-            67,    //    422    38536    67
-            67,    //    423    38664    67
-            67,    //    424    38792    67
-            67,    //    425    38920    67
-            67,    //    426    39048    67
-            67,    //    427    39176    67
-            67,    //    428    39304    67
-            67,    //    429    39432    67
-            67,    //    430    39560    67
-            67,    //    431    39688    67
-            67,    //    432    39816    67
-            67,    //    433    39944    67
-            67,    //    434    40072    67
-            67,    //    435    40200    67
-            67,    //    436    40328    67
-            67,    //    437    40456    67
-            67,    //    438    40584    67
-            67,    //    439    40712    67
-            67,    //    440    40840    67
-            68,    //    441    40968    68
-            68,    //    442    41096    68
-            68,    //    443    41224    68
-            68,    //    444    41352    68
-            68,    //    445    41480    68
-            68,    //    446    41608    68
-            68,    //    447    41736    68
-            68,    //    448    41864    68
-            68,    //    449    41992    68
-            68,    //    450    42120    68
-            68,    //    451    42248    68
-            68,    //    452    42376    68
-            68,    //    453    42504    68
-            68,    //    454    42632    68
-            68,    //    455    42760    68
-            68,    //    456    42888    68
-            68,    //    457    43016    68
-            68,    //    458    43144    68
-            68,    //    459    43272    68
-            68,    //    460    43400    68
-            68,    //    461    43528    68
-            68,    //    462    43656    68
-            68,    //    463    43784    68
-            68,    //    464    43912    68
-            68,    //    465    44040    68
-            68,    //    466    44168    68
-            68,    //    467    44296    68
-            68,    //    468    44424    68
-            68,    //    469    44552    68
-            68,    //    470    44680    68
-            68,    //    471    44808    68
-            68,    //    472    44936    68
-            68,    //    473    45064    68
-            68,    //    474    45192    68
-            68,    //    475    45320    68
-            68,    //    476    45448    68
-            68,    //    477    45576    68
-            68,    //    478    45704    68
-            68,    //    479    45832    68
-            68,    //    480    45960    68
-            68,    //    481    46088    68
-            68,    //    482    46216    68
-            68,    //    483    46344    68
-            68,    //    484    46472    68
-            68,    //    485    46600    68
-            68,    //    486    46728    68
-            68,    //    487    46856    68
-            68,    //    488    46984    68
-            68,    //    489    47112    68
-            68,    //    490    47240    68
-            68,    //    491    47368    68
-            68,    //    492    47496    68
-            68,    //    493    47624    68
-            68,    //    494    47752    68
-            68,    //    495    47880    68
-            68,    //    496    48008    68
-            68,    //    497    48136    68
-            68,    //    498    48264    68
-            68,    //    499    48392    68
-            68,    //    500    48520    68
-            68,    //    501    48648    68
-            68,    //    502    48776    68
-            68,    //    503    48904    68
-            68,    //    504    49032    68
-            69,    //    505    49160    69
-            69,    //    506    49288    69
-            69,    //    507    49416    69
-            69,    //    508    49544    69
-            69,    //    509    49672    69
-            69,    //    510    49800    69
-            69,    //    511    49928    69
-            69,    //    512    50056    69
-            69,    //    513    50184    69
-            69,    //    514    50312    69
-            69,    //    515    50440    69
-            69,    //    516    50568    69
-            69,    //    517    50696    69
-            69,    //    518    50824    69
-            69,    //    519    50952    69
-            69,    //    520    51080    69
-            69,    //    521    51208    69
-            69,    //    522    51336    69
-            69,    //    523    51464    69
-            69,    //    524    51592    69
-            69,    //    525    51720    69
-            69,    //    526    51848    69
-            69,    //    527    51976    69
-            69,    //    528    52104    69
-            69,    //    529    52232    69
-            69,    //    530    52360    69
-            69,    //    531    52488    69
-            69,    //    532    52616    69
-            69,    //    533    52744    69
-            69,    //    534    52872    69
-            69,    //    535    53000    69
-            69,    //    536    53128    69
-            69,    //    537    53256    69
-            69,    //    538    53384    69
-            69,    //    539    53512    69
-            69,    //    540    53640    69
-            69,    //    541    53768    69
-            69,    //    542    53896    69
-            69,    //    543    54024    69
-            69,    //    544    54152    69
-            69,    //    545    54280    69
-            69,    //    546    54408    69
-            69,    //    547    54536    69
-            69,    //    548    54664    69
-            69,    //    549    54792    69
-            69,    //    550    54920    69
-            69,    //    551    55048    69
-            69,    //    552    55176    69
-            69,    //    553    55304    69
-            69,    //    554    55432    69
-            69,    //    555    55560    69
-            69,    //    556    55688    69
-            69,    //    557    55816    69
-            69,    //    558    55944    69
-            69,    //    559    56072    69
-            69,    //    560    56200    69
-            69,    //    561    56328    69
-            69,    //    562    56456    69
-            69,    //    563    56584    69
-            69,    //    564    56712    69
-            69,    //    565    56840    69
-            69,    //    566    56968    69
-            69,    //    567    57096    69
-            69,    //    568    57224    69
-            70,    //    569    57352    70
-            70,    //    570    57480    70
-            70,    //    571    57608    70
-            70,    //    572    57736    70
-            70,    //    573    57864    70
-            70,    //    574    57992    70
-            70,    //    575    58120    70
-            70,    //    576    58248    70
-            70,    //    577    58376    70
-            70,    //    578    58504    70
-            70,    //    579    58632    70
-            70,    //    580    58760    70
-            70,    //    581    58888    70
-            70,    //    582    59016    70
-            70,    //    583    59144    70
-            70,    //    584    59272    70
-            70,    //    585    59400    70
-            70,    //    586    59528    70
-            70,    //    587    59656    70
-            70,    //    588    59784    70
-            70,    //    589    59912    70
-            70,    //    590    60040    70
-            70,    //    591    60168    70
-            70,    //    592    60296    70
-            70,    //    593    60424    70
-            70,    //    594    60552    70
-            70,    //    595    60680    70
-            70,    //    596    60808    70
-            70,    //    597    60936    70
-            70,    //    598    61064    70
-            70,    //    599    61192    70
-            70,    //    600    61320    70
-            70,    //    601    61448    70
-            70,    //    602    61576    70
-            70,    //    603    61704    70
-            70,    //    604    61832    70
-            70,    //    605    61960    70
-            70,    //    606    62088    70
-            70,    //    607    62216    70
-            70,    //    608    62344    70
-            70,    //    609    62472    70
-            70,    //    610    62600    70
-            70,    //    611    62728    70
-            70,    //    612    62856    70
-            70,    //    613    62984    70
-            70,    //    614    63112    70
-            70,    //    615    63240    70
-            70,    //    616    63368    70
-            70,    //    617    63496    70
-            70,    //    618    63624    70
-            70,    //    619    63752    70
-            70,    //    620    63880    70
-            70,    //    621    64008    70
-            70,    //    622    64136    70
-            70,    //    623    64264    70
-            70,    //    624    64392    70
-            70,    //    625    64520    70
-            70,    //    626    64648    70
-            70,    //    627    64776    70
-            70,    //    628    64904    70
-            70,    //    629    65032    70
-            70,    //    630    65160    70
-            70,    //    631    65288    70
-            70,    //    632    65416    70
-            71,    //    633    65544    71
-            71,    //    634    65672    71
-            71,    //    635    65800    71
-            71,    //    636    65928    71
-            71,    //    637    66056    71
-            71,    //    638    66184    71
-            71,    //    639    66312    71
-            71,    //    640    66440    71
-            71,    //    641    66568    71
-            71,    //    642    66696    71
-            71,    //    643    66824    71
-            71,    //    644    66952    71
-            71,    //    645    67080    71
-            71,    //    646    67208    71
-            71,    //    647    67336    71
-            71,    //    648    67464    71
-            71,    //    649    67592    71
-            71,    //    650    67720    71
-            71,    //    651    67848    71
-            71,    //    652    67976    71
-            71,    //    653    68104    71
-            71,    //    654    68232    71
-            71,    //    655    68360    71
-            71,    //    656    68488    71
-            71,    //    657    68616    71
-            71,    //    658    68744    71
-            71,    //    659    68872    71
-            71,    //    660    69000    71
-            71,    //    661    69128    71
-            71,    //    662    69256    71
-            71,    //    663    69384    71
-            71,    //    664    69512    71
-            71,    //    665    69640    71
-            71,    //    666    69768    71
-            71,    //    667    69896    71
-            71,    //    668    70024    71
-            71,    //    669    70152    71
-            71,    //    670    70280    71
-            71,    //    671    70408    71
-            71,    //    672    70536    71
-            71,    //    673    70664    71
-            71,    //    674    70792    71
-            71,    //    675    70920    71
-            71,    //    676    71048    71
-            71,    //    677    71176    71
-            71,    //    678    71304    71
-            71,    //    679    71432    71
-            71,    //    680    71560    71
-            71,    //    681    71688    71
-            71,    //    682    71816    71
-            71,    //    683    71944    71
-            71,    //    684    72072    71
-            71,    //    685    72200    71
-            71,    //    686    72328    71
-            71,    //    687    72456    71
-            71,    //    688    72584    71
-            71,    //    689    72712    71
-            71,    //    690    72840    71
-            71,    //    691    72968    71
-            71,    //    692    73096    71
-            71,    //    693    73224    71
-            71,    //    694    73352    71
-            71,    //    695    73480    71
-            71,    //    696    73608    71
-            72,    //    697    73736    72
-            72,    //    698    73864    72
-            72,    //    699    73992    72
-            72,    //    700    74120    72
-            72,    //    701    74248    72
-            72,    //    702    74376    72
-            72,    //    703    74504    72
-            72,    //    704    74632    72
-            72,    //    705    74760    72
-            72,    //    706    74888    72
-            72,    //    707    75016    72
-            72,    //    708    75144    72
-            72,    //    709    75272    72
-            72,    //    710    75400    72
-            72,    //    711    75528    72
-            72,    //    712    75656    72
-            72,    //    713    75784    72
-            72,    //    714    75912    72
-            72,    //    715    76040    72
-            72,    //    716    76168    72
-            72,    //    717    76296    72
-            72,    //    718    76424    72
-            72,    //    719    76552    72
-            72,    //    720    76680    72
-            72,    //    721    76808    72
-            72,    //    722    76936    72
-            72,    //    723    77064    72
-            72,    //    724    77192    72
-            72,    //    725    77320    72
-            72,    //    726    77448    72
-            72,    //    727    77576    72
-            72,    //    728    77704    72
-            72,    //    729    77832    72
-            72,    //    730    77960    72
-            72,    //    731    78088    72
-            72,    //    732    78216    72
-            72,    //    733    78344    72
-            72,    //    734    78472    72
-            72,    //    735    78600    72
-            72,    //    736    78728    72
-            72,    //    737    78856    72
-            72,    //    738    78984    72
-            72,    //    739    79112    72
-            72,    //    740    79240    72
-            72,    //    741    79368    72
-            72,    //    742    79496    72
-            72,    //    743    79624    72
-            72,    //    744    79752    72
-            72,    //    745    79880    72
-            72,    //    746    80008    72
-            72,    //    747    80136    72
-            72,    //    748    80264    72
-            72,    //    749    80392    72
-            72,    //    750    80520    72
-            72,    //    751    80648    72
-            72,    //    752    80776    72
-            72,    //    753    80904    72
-            72,    //    754    81032    72
-            72,    //    755    81160    72
-            72,    //    756    81288    72
-            72,    //    757    81416    72
-            72,    //    758    81544    72
-            72,    //    759    81672    72
-            72,    //    760    81800    72
-            73,    //    761    81928    73
-            73,    //    762    82056    73
-            73,    //    763    82184    73
-            73,    //    764    82312    73
-            73,    //    765    82440    73
-            73,    //    766    82568    73
-            73,    //    767    82696    73
-            73,    //    768    82824    73
-            73,    //    769    82952    73
-            73,    //    770    83080    73
-            73,    //    771    83208    73
-            73,    //    772    83336    73
-            73,    //    773    83464    73
-            73,    //    774    83592    73
-            73,    //    775    83720    73
-            73,    //    776    83848    73
-            73,    //    777    83976    73
-            73,    //    778    84104    73
-            73,    //    779    84232    73
-            73,    //    780    84360    73
-            73,    //    781    84488    73
-            73,    //    782    84616    73
-            73,    //    783    84744    73
-            73,    //    784    84872    73
-            73,    //    785    85000    73
-            73,    //    786    85128    73
-            73,    //    787    85256    73
-            73,    //    788    85384    73
-            73,    //    789    85512    73
-            73,    //    790    85640    73
-            73,    //    791    85768    73
-            73,    //    792    85896    73
-            73,    //    793    86024    73
-            73,    //    794    86152    73
-            73,    //    795    86280    73
-            73,    //    796    86408    73
-            73,    //    797    86536    73
-            73,    //    798    86664    73
-            73,    //    799    86792    73
-            73,    //    800    86920    73
-            73,    //    801    87048    73
-            73,    //    802    87176    73
-            73,    //    803    87304    73
-            73,    //    804    87432    73
-            73,    //    805    87560    73
-            73,    //    806    87688    73
-            73,    //    807    87816    73
-            73,    //    808    87944    73
-            73,    //    809    88072    73
-            73,    //    810    88200    73
-            73,    //    811    88328    73
-            73,    //    812    88456    73
-            73,    //    813    88584    73
-            73,    //    814    88712    73
-            73,    //    815    88840    73
-            73,    //    816    88968    73
-            73,    //    817    89096    73
-            73,    //    818    89224    73
-            73,    //    819    89352    73
-            73,    //    820    89480    73
-            73,    //    821    89608    73
-            73,    //    822    89736    73
-            73,    //    823    89864    73
-            73,    //    824    89992    73
-            74,    //    825    90120    74
-            74,    //    826    90248    74
-            74,    //    827    90376    74
-            74,    //    828    90504    74
-            74,    //    829    90632    74
-            74,    //    830    90760    74
-            74,    //    831    90888    74
-            74,    //    832    91016    74
-            74,    //    833    91144    74
-            74,    //    834    91272    74
-            74,    //    835    91400    74
-            74,    //    836    91528    74
-            74,    //    837    91656    74
-            74,    //    838    91784    74
-            74,    //    839    91912    74
-            74,    //    840    92040    74
-            74,    //    841    92168    74
-            74,    //    842    92296    74
-            74,    //    843    92424    74
-            74,    //    844    92552    74
-            74,    //    845    92680    74
-            74,    //    846    92808    74
-            74,    //    847    92936    74
-            74,    //    848    93064    74
-            74,    //    849    93192    74
-            74,    //    850    93320    74
-            74,    //    851    93448    74
-            74,    //    852    93576    74
-            74,    //    853    93704    74
-            74,    //    854    93832    74
-            74,    //    855    93960    74
-            74,    //    856    94088    74
-            74,    //    857    94216    74
-            74,    //    858    94344    74
-            74,    //    859    94472    74
-            74,    //    860    94600    74
-            74,    //    861    94728    74
-            74,    //    862    94856    74
-            74,    //    863    94984    74
-            74,    //    864    95112    74
-            74,    //    865    95240    74
-            74,    //    866    95368    74
-            74,    //    867    95496    74
-            74,    //    868    95624    74
-            74,    //    869    95752    74
-            74,    //    870    95880    74
-            74,    //    871    96008    74
-            74,    //    872    96136    74
-            74,    //    873    96264    74
-            74,    //    874    96392    74
-            74,    //    875    96520    74
-            74,    //    876    96648    74
-            74,    //    877    96776    74
-            74,    //    878    96904    74
-            74,    //    879    97032    74
-            74,    //    880    97160    74
-            74,    //    881    97288    74
-            74,    //    882    97416    74
-            74,    //    883    97544    74
-            74,    //    884    97672    74
-            74,    //    885    97800    74
-            74,    //    886    97928    74
-            74,    //    887    98056    74
-            74,    //    888    98184    74
-            75,    //    889    98312    75
-            75,    //    890    98440    75
-            75,    //    891    98568    75
-            75,    //    892    98696    75
-            75,    //    893    98824    75
-            75,    //    894    98952    75
-            75,    //    895    99080    75
-            75,    //    896    99208    75
-            75,    //    897    99336    75
-            75,    //    898    99464    75
-            75,    //    899    99592    75
-            75,    //    900    99720    75
-            75,    //    901    99848    75
-            75,    //    902    99976    75
-            75,    //    903    100104    75
-            75,    //    904    100232    75
-            75,    //    905    100360    75
-            75,    //    906    100488    75
-            75,    //    907    100616    75
-            75,    //    908    100744    75
-            75,    //    909    100872    75
-            75,    //    910    101000    75
-            75,    //    911    101128    75
-            75,    //    912    101256    75
-            75,    //    913    101384    75
-            75,    //    914    101512    75
-            75,    //    915    101640    75
-            75,    //    916    101768    75
-            75,    //    917    101896    75
-            75,    //    918    102024    75
-            75,    //    919    102152    75
-            75,    //    920    102280    75
-            75,    //    921    102408    75
-            75,    //    922    102536    75
-            75,    //    923    102664    75
-            75,    //    924    102792    75
-            75,    //    925    102920    75
-            75,    //    926    103048    75
-            75,    //    927    103176    75
-            75,    //    928    103304    75
-            75,    //    929    103432    75
-            75,    //    930    103560    75
-            75,    //    931    103688    75
-            75,    //    932    103816    75
-            75,    //    933    103944    75
-            75,    //    934    104072    75
-            75,    //    935    104200    75
-            75,    //    936    104328    75
-            75,    //    937    104456    75
-            75,    //    938    104584    75
-            75,    //    939    104712    75
-            75,    //    940    104840    75
-            75,    //    941    104968    75
-            75,    //    942    105096    75
-            75,    //    943    105224    75
-            75,    //    944    105352    75
-            75,    //    945    105480    75
-            75,    //    946    105608    75
-            75,    //    947    105736    75
-            75,    //    948    105864    75
-            75,    //    949    105992    75
-            75,    //    950    106120    75
-            75,    //    951    106248    75
-            75,    //    952    106376    75
-            76,    //    953    106504    76
-            76,    //    954    106632    76
-            76,    //    955    106760    76
-            76,    //    956    106888    76
-            76,    //    957    107016    76
-            76,    //    958    107144    76
-            76,    //    959    107272    76
-            76,    //    960    107400    76
-            76,    //    961    107528    76
-            76,    //    962    107656    76
-            76,    //    963    107784    76
-            76,    //    964    107912    76
-            76,    //    965    108040    76
-            76,    //    966    108168    76
-            76,    //    967    108296    76
-            76,    //    968    108424    76
-            76,    //    969    108552    76
-            76,    //    970    108680    76
-            76,    //    971    108808    76
-            76,    //    972    108936    76
-            76,    //    973    109064    76
-            76,    //    974    109192    76
-            76,    //    975    109320    76
-            76,    //    976    109448    76
-            76,    //    977    109576    76
-            76,    //    978    109704    76
-            76,    //    979    109832    76
-            76,    //    980    109960    76
-            76,    //    981    110088    76
-            76,    //    982    110216    76
-            76,    //    983    110344    76
-            76,    //    984    110472    76
-            76,    //    985    110600    76
-            76,    //    986    110728    76
-            76,    //    987    110856    76
-            76,    //    988    110984    76
-            76,    //    989    111112    76
-            76,    //    990    111240    76
-            76,    //    991    111368    76
-            76,    //    992    111496    76
-            76,    //    993    111624    76
-            76,    //    994    111752    76
-            76,    //    995    111880    76
-            76,    //    996    112008    76
-            76,    //    997    112136    76
-            76,    //    998    112264    76
-            76,    //    999    112392    76
-            76,    //    1000    112520    76
-            76,    //    1001    112648    76
-            76,    //    1002    112776    76
-            76,    //    1003    112904    76
-            76,    //    1004    113032    76
-            76,    //    1005    113160    76
-            76,    //    1006    113288    76
-            76,    //    1007    113416    76
-            76,    //    1008    113544    76
-            76,    //    1009    113672    76
-            76,    //    1010    113800    76
-            76,    //    1011    113928    76
-            76,    //    1012    114056    76
-            76,    //    1013    114184    76
-            76,    //    1014    114312    76
-            76,    //    1015    114440    76
-            76,    //    1016    114568    76
-            77,    //    1017    114696    77
-            77,    //    1018    114824    77
-            77,    //    1019    114952    77
-            77,    //    1020    115080    77
-            77,    //    1021    115208    77
-            77,    //    1022    115336    77
-            77,    //    1023    115464    77
-            77,    //    1024    115592    77
-            77,    //    1025    115720    77
-            77,    //    1026    115848    77
-            77,    //    1027    115976    77
-            77,    //    1028    116104    77
-            77,    //    1029    116232    77
-            77,    //    1030    116360    77
-            77,    //    1031    116488    77
-            77,    //    1032    116616    77
-            77,    //    1033    116744    77
-            77,    //    1034    116872    77
-            77,    //    1035    117000    77
-            77,    //    1036    117128    77
-            77,    //    1037    117256    77
-            77,    //    1038    117384    77
-            77,    //    1039    117512    77
-            77,    //    1040    117640    77
-            77,    //    1041    117768    77
-            77,    //    1042    117896    77
-            77,    //    1043    118024    77
-            77,    //    1044    118152    77
-            77,    //    1045    118280    77
-            77,    //    1046    118408    77
-            77,    //    1047    118536    77
-            77,    //    1048    118664    77
-            77,    //    1049    118792    77
-            77,    //    1050    118920    77
-            77,    //    1051    119048    77
-            77,    //    1052    119176    77
-            77,    //    1053    119304    77
-            77,    //    1054    119432    77
-            77,    //    1055    119560    77
-            77,    //    1056    119688    77
-            77,    //    1057    119816    77
-            77,    //    1058    119944    77
-            77,    //    1059    120072    77
-            77,    //    1060    120200    77
-            77,    //    1061    120328    77
-            77,    //    1062    120456    77
-            77,    //    1063    120584    77
-            77,    //    1064    120712    77
-            77,    //    1065    120840    77
-            77,    //    1066    120968    77
-            77,    //    1067    121096    77
-            77,    //    1068    121224    77
-            77,    //    1069    121352    77
-            77,    //    1070    121480    77
-            77,    //    1071    121608    77
-            77,    //    1072    121736    77
-            77,    //    1073    121864    77
-            77,    //    1074    121992    77
-            77,    //    1075    122120    77
-            77,    //    1076    122248    77
-            77,    //    1077    122376    77
-            77,    //    1078    122504    77
-            77,    //    1079    122632    77
-            77,    //    1080    122760    77
-            78,    //    1081    122888    78
-            78,    //    1082    123016    78
-            78,    //    1083    123144    78
-            78,    //    1084    123272    78
-            78,    //    1085    123400    78
-            78,    //    1086    123528    78
-            78,    //    1087    123656    78
-            78,    //    1088    123784    78
-            78,    //    1089    123912    78
-            78,    //    1090    124040    78
-            78,    //    1091    124168    78
-            78,    //    1092    124296    78
-            78,    //    1093    124424    78
-            78,    //    1094    124552    78
-            78,    //    1095    124680    78
-            78,    //    1096    124808    78
-            78,    //    1097    124936    78
-            78,    //    1098    125064    78
-            78,    //    1099    125192    78
-            78,    //    1100    125320    78
-            78,    //    1101    125448    78
-            78,    //    1102    125576    78
-            78,    //    1103    125704    78
-            78,    //    1104    125832    78
-            78,    //    1105    125960    78
-            78,    //    1106    126088    78
-            78,    //    1107    126216    78
-            78,    //    1108    126344    78
-            78,    //    1109    126472    78
-            78,    //    1110    126600    78
-            78,    //    1111    126728    78
-            78,    //    1112    126856    78
-            78,    //    1113    126984    78
-            78,    //    1114    127112    78
-            78,    //    1115    127240    78
-            78,    //    1116    127368    78
-            78,    //    1117    127496    78
-            78,    //    1118    127624    78
-            78,    //    1119    127752    78
-            78,    //    1120    127880    78
-            78,    //    1121    128008    78
-            78,    //    1122    128136    78
-            78,    //    1123    128264    78
-            78,    //    1124    128392    78
-            78,    //    1125    128520    78
-            78,    //    1126    128648    78
-            78,    //    1127    128776    78
-            78,    //    1128    128904    78
-            78,    //    1129    129032    78
-            78,    //    1130    129160    78
-            78,    //    1131    129288    78
-            78,    //    1132    129416    78
-            78,    //    1133    129544    78
-            78,    //    1134    129672    78
-            78,    //    1135    129800    78
-            78,    //    1136    129928    78
-            78,    //    1137    130056    78
-            78,    //    1138    130184    78
-            78,    //    1139    130312    78
-            78,    //    1140    130440    78
-            78,    //    1141    130568    78
-            78,    //    1142    130696    78
-            78,    //    1143    130824    78
-            78,    //    1144    130952    78
-            79,    //    1145    131080    79
-            79,    //    1146    131208    79
-            79,    //    1147    131336    79
-            79,    //    1148    131464    79
-            79,    //    1149    131592    79
-            79,    //    1150    131720    79
-            79,    //    1151    131848    79
-            79,    //    1152    131976    79
-            79,    //    1153    132104    79
-            79,    //    1154    132232    79
-            79,    //    1155    132360    79
-            79,    //    1156    132488    79
-            79,    //    1157    132616    79
-            79,    //    1158    132744    79
-            79,    //    1159    132872    79
-            79,    //    1160    133000    79
-            79,    //    1161    133128    79
-            79,    //    1162    133256    79
-            79,    //    1163    133384    79
-            79,    //    1164    133512    79
-            79,    //    1165    133640    79
-            79,    //    1166    133768    79
-            79,    //    1167    133896    79
-            79,    //    1168    134024    79
-            79,    //    1169    134152    79
-            79,    //    1170    134280    79
-            79,    //    1171    134408    79
-            79,    //    1172    134536    79
-            79,    //    1173    134664    79
-            79,    //    1174    134792    79
-            79,    //    1175    134920    79
-            79,    //    1176    135048    79
-            79,    //    1177    135176    79
-            79,    //    1178    135304    79
-            79,    //    1179    135432    79
-            79,    //    1180    135560    79
-            79,    //    1181    135688    79
-            79,    //    1182    135816    79
-            79,    //    1183    135944    79
-            79,    //    1184    136072    79
-            79,    //    1185    136200    79
-            79,    //    1186    136328    79
-            79,    //    1187    136456    79
-            79,    //    1188    136584    79
-            79,    //    1189    136712    79
-            79,    //    1190    136840    79
-            79,    //    1191    136968    79
-            79,    //    1192    137096    79
-            79,    //    1193    137224    79
-            79,    //    1194    137352    79
-            79,    //    1195    137480    79
-            79,    //    1196    137608    79
-            79,    //    1197    137736    79
-            79,    //    1198    137864    79
-            79,    //    1199    137992    79
-            79,    //    1200    138120    79
-            79,    //    1201    138248    79
-            79,    //    1202    138376    79
-            79,    //    1203    138504    79
-            79,    //    1204    138632    79
-            79,    //    1205    138760    79
-            79,    //    1206    138888    79
-            79,    //    1207    139016    79
-            79,    //    1208    139144    79
-            80,    //    1209    139272    80
-            80,    //    1210    139400    80
-            80,    //    1211    139528    80
-            80,    //    1212    139656    80
-            80,    //    1213    139784    80
-            80,    //    1214    139912    80
-            80,    //    1215    140040    80
-            80,    //    1216    140168    80
-            80,    //    1217    140296    80
-            80,    //    1218    140424    80
-            80,    //    1219    140552    80
-            80,    //    1220    140680    80
-            80,    //    1221    140808    80
-            80,    //    1222    140936    80
-            80,    //    1223    141064    80
-            80,    //    1224    141192    80
-            80,    //    1225    141320    80
-            80,    //    1226    141448    80
-            80,    //    1227    141576    80
-            80,    //    1228    141704    80
-            80,    //    1229    141832    80
-            80,    //    1230    141960    80
-            80,    //    1231    142088    80
-            80,    //    1232    142216    80
-            80,    //    1233    142344    80
-            80,    //    1234    142472    80
-            80,    //    1235    142600    80
-            80,    //    1236    142728    80
-            80,    //    1237    142856    80
-            80,    //    1238    142984    80
-            80,    //    1239    143112    80
-            80,    //    1240    143240    80
-            80,    //    1241    143368    80
-            80,    //    1242    143496    80
-            80,    //    1243    143624    80
-            80,    //    1244    143752    80
-            80,    //    1245    143880    80
-            80,    //    1246    144008    80
-            80,    //    1247    144136    80
-            80,    //    1248    144264    80
-            80,    //    1249    144392    80
-            80,    //    1250    144520    80
-            80,    //    1251    144648    80
-            80,    //    1252    144776    80
-            80,    //    1253    144904    80
-            80,    //    1254    145032    80
-            80,    //    1255    145160    80
-            80,    //    1256    145288    80
-            80,    //    1257    145416    80
-            80,    //    1258    145544    80
-            80,    //    1259    145672    80
-            80,    //    1260    145800    80
-            80,    //    1261    145928    80
-            80,    //    1262    146056    80
-            80,    //    1263    146184    80
-            80,    //    1264    146312    80
-            80,    //    1265    146440    80
-            80,    //    1266    146568    80
-            80,    //    1267    146696    80
-            80,    //    1268    146824    80
-            80,    //    1269    146952    80
-            80,    //    1270    147080    80
-            80,    //    1271    147208    80
-            80,    //    1272    147336    80
-            80,    //    1273    147464    80
-            80,    //    1274    147592    80
-            80,    //    1275    147720    80
-            80,    //    1276    147848    80
-            80,    //    1277    147976    80
-            80,    //    1278    148104    80
-            80,    //    1279    148232    80
-            80,    //    1280    148360    80
-            80,    //    1281    148488    80
-            80,    //    1282    148616    80
-            80,    //    1283    148744    80
-            80,    //    1284    148872    80
-            80,    //    1285    149000    80
-            80,    //    1286    149128    80
-            80,    //    1287    149256    80
-            80,    //    1288    149384    80
-            80,    //    1289    149512    80
-            80,    //    1290    149640    80
-            80,    //    1291    149768    80
-            80,    //    1292    149896    80
-            80,    //    1293    150024    80
-            80,    //    1294    150152    80
-            80,    //    1295    150280    80
-            80,    //    1296    150408    80
-            80,    //    1297    150536    80
-            80,    //    1298    150664    80
-            80,    //    1299    150792    80
-            80,    //    1300    150920    80
-            80,    //    1301    151048    80
-            80,    //    1302    151176    80
-            80,    //    1303    151304    80
-            80,    //    1304    151432    80
-            80,    //    1305    151560    80
-            80,    //    1306    151688    80
-            80,    //    1307    151816    80
-            80,    //    1308    151944    80
-            80,    //    1309    152072    80
-            80,    //    1310    152200    80
-            80,    //    1311    152328    80
-            80,    //    1312    152456    80
-            80,    //    1313    152584    80
-            80,    //    1314    152712    80
-            80,    //    1315    152840    80
-            80,    //    1316    152968    80
-            80,    //    1317    153096    80
-            80,    //    1318    153224    80
-            80,    //    1319    153352    80
-            80,    //    1320    153480    80
-            80,    //    1321    153608    80
-            80,    //    1322    153736    80
-            80,    //    1323    153864    80
-            80,    //    1324    153992    80
-            80,    //    1325    154120    80
-            80,    //    1326    154248    80
-            80,    //    1327    154376    80
-            80,    //    1328    154504    80
-            80,    //    1329    154632    80
-            80,    //    1330    154760    80
-            80,    //    1331    154888    80
-            80,    //    1332    155016    80
-            80,    //    1333    155144    80
-            80,    //    1334    155272    80
-            80,    //    1335    155400    80
-            80,    //    1336    155528    80
-            81,    //    1337    155656    81
-            81,    //    1338    155784    81
-            81,    //    1339    155912    81
-            81,    //    1340    156040    81
-            81,    //    1341    156168    81
-            81,    //    1342    156296    81
-            81,    //    1343    156424    81
-            81,    //    1344    156552    81
-            81,    //    1345    156680    81
-            81,    //    1346    156808    81
-            81,    //    1347    156936    81
-            81,    //    1348    157064    81
-            81,    //    1349    157192    81
-            81,    //    1350    157320    81
-            81,    //    1351    157448    81
-            81,    //    1352    157576    81
-            81,    //    1353    157704    81
-            81,    //    1354    157832    81
-            81,    //    1355    157960    81
-            81,    //    1356    158088    81
-            81,    //    1357    158216    81
-            81,    //    1358    158344    81
-            81,    //    1359    158472    81
-            81,    //    1360    158600    81
-            81,    //    1361    158728    81
-            81,    //    1362    158856    81
-            81,    //    1363    158984    81
-            81,    //    1364    159112    81
-            81,    //    1365    159240    81
-            81,    //    1366    159368    81
-            81,    //    1367    159496    81
-            81,    //    1368    159624    81
-            81,    //    1369    159752    81
-            81,    //    1370    159880    81
-            81,    //    1371    160008    81
-            81,    //    1372    160136    81
-            81,    //    1373    160264    81
-            81,    //    1374    160392    81
-            81,    //    1375    160520    81
-            81,    //    1376    160648    81
-            81,    //    1377    160776    81
-            81,    //    1378    160904    81
-            81,    //    1379    161032    81
-            81,    //    1380    161160    81
-            81,    //    1381    161288    81
-            81,    //    1382    161416    81
-            81,    //    1383    161544    81
-            81,    //    1384    161672    81
-            81,    //    1385    161800    81
-            81,    //    1386    161928    81
-            81,    //    1387    162056    81
-            81,    //    1388    162184    81
-            81,    //    1389    162312    81
-            81,    //    1390    162440    81
-            81,    //    1391    162568    81
-            81,    //    1392    162696    81
-            81,    //    1393    162824    81
-            81,    //    1394    162952    81
-            81,    //    1395    163080    81
-            81,    //    1396    163208    81
-            81,    //    1397    163336    81
-            81,    //    1398    163464    81
-            81,    //    1399    163592    81
-            81,    //    1400    163720    81
-            81,    //    1401    163848    81
-            81,    //    1402    163976    81
-            81,    //    1403    164104    81
-            81,    //    1404    164232    81
-            81,    //    1405    164360    81
-            81,    //    1406    164488    81
-            81,    //    1407    164616    81
-            81,    //    1408    164744    81
-            81,    //    1409    164872    81
-            81,    //    1410    165000    81
-            81,    //    1411    165128    81
-            81,    //    1412    165256    81
-            81,    //    1413    165384    81
-            81,    //    1414    165512    81
-            81,    //    1415    165640    81
-            81,    //    1416    165768    81
-            81,    //    1417    165896    81
-            81,    //    1418    166024    81
-            81,    //    1419    166152    81
-            81,    //    1420    166280    81
-            81,    //    1421    166408    81
-            81,    //    1422    166536    81
-            81,    //    1423    166664    81
-            81,    //    1424    166792    81
-            81,    //    1425    166920    81
-            81,    //    1426    167048    81
-            81,    //    1427    167176    81
-            81,    //    1428    167304    81
-            81,    //    1429    167432    81
-            81,    //    1430    167560    81
-            81,    //    1431    167688    81
-            81,    //    1432    167816    81
-            81,    //    1433    167944    81
-            81,    //    1434    168072    81
-            81,    //    1435    168200    81
-            81,    //    1436    168328    81
-            81,    //    1437    168456    81
-            81,    //    1438    168584    81
-            81,    //    1439    168712    81
-            81,    //    1440    168840    81
-            81,    //    1441    168968    81
-            81,    //    1442    169096    81
-            81,    //    1443    169224    81
-            81,    //    1444    169352    81
-            81,    //    1445    169480    81
-            81,    //    1446    169608    81
-            81,    //    1447    169736    81
-            81,    //    1448    169864    81
-            81,    //    1449    169992    81
-            81,    //    1450    170120    81
-            81,    //    1451    170248    81
-            81,    //    1452    170376    81
-            81,    //    1453    170504    81
-            81,    //    1454    170632    81
-            81,    //    1455    170760    81
-            81,    //    1456    170888    81
-            81,    //    1457    171016    81
-            81,    //    1458    171144    81
-            81,    //    1459    171272    81
-            81,    //    1460    171400    81
-            81,    //    1461    171528    81
-            81,    //    1462    171656    81
-            81,    //    1463    171784    81
-            81,    //    1464    171912    81
-            82,    //    1465    172040    82
-            82,    //    1466    172168    82
-            82,    //    1467    172296    82
-            82,    //    1468    172424    82
-            82,    //    1469    172552    82
-            82,    //    1470    172680    82
-            82,    //    1471    172808    82
-            82,    //    1472    172936    82
-            82,    //    1473    173064    82
-            82,    //    1474    173192    82
-            82,    //    1475    173320    82
-            82,    //    1476    173448    82
-            82,    //    1477    173576    82
-            82,    //    1478    173704    82
-            82,    //    1479    173832    82
-            82,    //    1480    173960    82
-            82,    //    1481    174088    82
-            82,    //    1482    174216    82
-            82,    //    1483    174344    82
-            82,    //    1484    174472    82
-            82,    //    1485    174600    82
-            82,    //    1486    174728    82
-            82,    //    1487    174856    82
-            82,    //    1488    174984    82
-            82,    //    1489    175112    82
-            82,    //    1490    175240    82
-            82,    //    1491    175368    82
-            82,    //    1492    175496    82
-            82,    //    1493    175624    82
-            82,    //    1494    175752    82
-            82,    //    1495    175880    82
-            82,    //    1496    176008    82
-            82,    //    1497    176136    82
-            82,    //    1498    176264    82
-            82,    //    1499    176392    82
-            82,    //    1500    176520    82
-            82,    //    1501    176648    82
-            82,    //    1502    176776    82
-            82,    //    1503    176904    82
-            82,    //    1504    177032    82
-            82,    //    1505    177160    82
-            82,    //    1506    177288    82
-            82,    //    1507    177416    82
-            82,    //    1508    177544    82
-            82,    //    1509    177672    82
-            82,    //    1510    177800    82
-            82,    //    1511    177928    82
-            82,    //    1512    178056    82
-            82,    //    1513    178184    82
-            82,    //    1514    178312    82
-            82,    //    1515    178440    82
-            82,    //    1516    178568    82
-            82,    //    1517    178696    82
-            82,    //    1518    178824    82
-            82,    //    1519    178952    82
-            82,    //    1520    179080    82
-            82,    //    1521    179208    82
-            82,    //    1522    179336    82
-            82,    //    1523    179464    82
-            82,    //    1524    179592    82
-            82,    //    1525    179720    82
-            82,    //    1526    179848    82
-            82,    //    1527    179976    82
-            82,    //    1528    180104    82
-            82,    //    1529    180232    82
-            82,    //    1530    180360    82
-            82,    //    1531    180488    82
-            82,    //    1532    180616    82
-            82,    //    1533    180744    82
-            82,    //    1534    180872    82
-            82,    //    1535    181000    82
-            82,    //    1536    181128    82
-            82,    //    1537    181256    82
-            82,    //    1538    181384    82
-            82,    //    1539    181512    82
-            82,    //    1540    181640    82
-            82,    //    1541    181768    82
-            82,    //    1542    181896    82
-            82,    //    1543    182024    82
-            82,    //    1544    182152    82
-            82,    //    1545    182280    82
-            82,    //    1546    182408    82
-            82,    //    1547    182536    82
-            82,    //    1548    182664    82
-            82,    //    1549    182792    82
-            82,    //    1550    182920    82
-            82,    //    1551    183048    82
-            82,    //    1552    183176    82
-            82,    //    1553    183304    82
-            82,    //    1554    183432    82
-            82,    //    1555    183560    82
-            82,    //    1556    183688    82
-            82,    //    1557    183816    82
-            82,    //    1558    183944    82
-            82,    //    1559    184072    82
-            82,    //    1560    184200    82
-            82,    //    1561    184328    82
-            82,    //    1562    184456    82
-            82,    //    1563    184584    82
-            82,    //    1564    184712    82
-            82,    //    1565    184840    82
-            82,    //    1566    184968    82
-            82,    //    1567    185096    82
-            82,    //    1568    185224    82
-            82,    //    1569    185352    82
-            82,    //    1570    185480    82
-            82,    //    1571    185608    82
-            82,    //    1572    185736    82
-            82,    //    1573    185864    82
-            82,    //    1574    185992    82
-            82,    //    1575    186120    82
-            82,    //    1576    186248    82
-            82,    //    1577    186376    82
-            82,    //    1578    186504    82
-            82,    //    1579    186632    82
-            82,    //    1580    186760    82
-            82,    //    1581    186888    82
-            82,    //    1582    187016    82
-            82,    //    1583    187144    82
-            82,    //    1584    187272    82
-            82,    //    1585    187400    82
-            82,    //    1586    187528    82
-            82,    //    1587    187656    82
-            82,    //    1588    187784    82
-            82,    //    1589    187912    82
-            82,    //    1590    188040    82
-            82,    //    1591    188168    82
-            82,    //    1592    188296    82
-            83,    //    1593    188424    83
-            83,    //    1594    188552    83
-            83,    //    1595    188680    83
-            83,    //    1596    188808    83
-            83,    //    1597    188936    83
-            83,    //    1598    189064    83
-            83,    //    1599    189192    83
-            83,    //    1600    189320    83
-            83,    //    1601    189448    83
-            83,    //    1602    189576    83
-            83,    //    1603    189704    83
-            83,    //    1604    189832    83
-            83,    //    1605    189960    83
-            83,    //    1606    190088    83
-            83,    //    1607    190216    83
-            83,    //    1608    190344    83
-            83,    //    1609    190472    83
-            83,    //    1610    190600    83
-            83,    //    1611    190728    83
-            83,    //    1612    190856    83
-            83,    //    1613    190984    83
-            83,    //    1614    191112    83
-            83,    //    1615    191240    83
-            83,    //    1616    191368    83
-            83,    //    1617    191496    83
-            83,    //    1618    191624    83
-            83,    //    1619    191752    83
-            83,    //    1620    191880    83
-            83,    //    1621    192008    83
-            83,    //    1622    192136    83
-            83,    //    1623    192264    83
-            83,    //    1624    192392    83
-            83,    //    1625    192520    83
-            83,    //    1626    192648    83
-            83,    //    1627    192776    83
-            83,    //    1628    192904    83
-            83,    //    1629    193032    83
-            83,    //    1630    193160    83
-            83,    //    1631    193288    83
-            83,    //    1632    193416    83
-            83,    //    1633    193544    83
-            83,    //    1634    193672    83
-            83,    //    1635    193800    83
-            83,    //    1636    193928    83
-            83,    //    1637    194056    83
-            83,    //    1638    194184    83
-            83,    //    1639    194312    83
-            83,    //    1640    194440    83
-            83,    //    1641    194568    83
-            83,    //    1642    194696    83
-            83,    //    1643    194824    83
-            83,    //    1644    194952    83
-            83,    //    1645    195080    83
-            83,    //    1646    195208    83
-            83,    //    1647    195336    83
-            83,    //    1648    195464    83
-            83,    //    1649    195592    83
-            83,    //    1650    195720    83
-            83,    //    1651    195848    83
-            83,    //    1652    195976    83
-            83,    //    1653    196104    83
-            83,    //    1654    196232    83
-            83,    //    1655    196360    83
-            83,    //    1656    196488    83
-            83,    //    1657    196616    83
-            83,    //    1658    196744    83
-            83,    //    1659    196872    83
-            83,    //    1660    197000    83
-            83,    //    1661    197128    83
-            83,    //    1662    197256    83
-            83,    //    1663    197384    83
-            83,    //    1664    197512    83
-            83,    //    1665    197640    83
-            83,    //    1666    197768    83
-            83,    //    1667    197896    83
-            83,    //    1668    198024    83
-            83,    //    1669    198152    83
-            83,    //    1670    198280    83
-            83,    //    1671    198408    83
-            83,    //    1672    198536    83
-            83,    //    1673    198664    83
-            83,    //    1674    198792    83
-            83,    //    1675    198920    83
-            83,    //    1676    199048    83
-            83,    //    1677    199176    83
-            83,    //    1678    199304    83
-            83,    //    1679    199432    83
-            83,    //    1680    199560    83
-            83,    //    1681    199688    83
-            83,    //    1682    199816    83
-            83,    //    1683    199944    83
-            83,    //    1684    200072    83
-            83,    //    1685    200200    83
-            83,    //    1686    200328    83
-            83,    //    1687    200456    83
-            83,    //    1688    200584    83
-            83,    //    1689    200712    83
-            83,    //    1690    200840    83
-            83,    //    1691    200968    83
-            83,    //    1692    201096    83
-            83,    //    1693    201224    83
-            83,    //    1694    201352    83
-            83,    //    1695    201480    83
-            83,    //    1696    201608    83
-            83,    //    1697    201736    83
-            83,    //    1698    201864    83
-            83,    //    1699    201992    83
-            83,    //    1700    202120    83
-            83,    //    1701    202248    83
-            83,    //    1702    202376    83
-            83,    //    1703    202504    83
-            83,    //    1704    202632    83
-            83,    //    1705    202760    83
-            83,    //    1706    202888    83
-            83,    //    1707    203016    83
-            83,    //    1708    203144    83
-            83,    //    1709    203272    83
-            83,    //    1710    203400    83
-            83,    //    1711    203528    83
-            83,    //    1712    203656    83
-            83,    //    1713    203784    83
-            83,    //    1714    203912    83
-            83,    //    1715    204040    83
-            83,    //    1716    204168    83
-            83,    //    1717    204296    83
-            83,    //    1718    204424    83
-            83,    //    1719    204552    83
-            83,    //    1720    204680    83
-            84,    //    1721    204808    84
-            84,    //    1722    204936    84
-            84,    //    1723    205064    84
-            84,    //    1724    205192    84
-            84,    //    1725    205320    84
-            84,    //    1726    205448    84
-            84,    //    1727    205576    84
-            84,    //    1728    205704    84
-            84,    //    1729    205832    84
-            84,    //    1730    205960    84
-            84,    //    1731    206088    84
-            84,    //    1732    206216    84
-            84,    //    1733    206344    84
-            84,    //    1734    206472    84
-            84,    //    1735    206600    84
-            84,    //    1736    206728    84
-            84,    //    1737    206856    84
-            84,    //    1738    206984    84
-            84,    //    1739    207112    84
-            84,    //    1740    207240    84
-            84,    //    1741    207368    84
-            84,    //    1742    207496    84
-            84,    //    1743    207624    84
-            84,    //    1744    207752    84
-            84,    //    1745    207880    84
-            84,    //    1746    208008    84
-            84,    //    1747    208136    84
-            84,    //    1748    208264    84
-            84,    //    1749    208392    84
-            84,    //    1750    208520    84
-            84,    //    1751    208648    84
-            84,    //    1752    208776    84
-            84,    //    1753    208904    84
-            84,    //    1754    209032    84
-            84,    //    1755    209160    84
-            84,    //    1756    209288    84
-            84,    //    1757    209416    84
-            84,    //    1758    209544    84
-            84,    //    1759    209672    84
-            84,    //    1760    209800    84
-            84,    //    1761    209928    84
-            84,    //    1762    210056    84
-            84,    //    1763    210184    84
-            84,    //    1764    210312    84
-            84,    //    1765    210440    84
-            84,    //    1766    210568    84
-            84,    //    1767    210696    84
-            84,    //    1768    210824    84
-            84,    //    1769    210952    84
-            84,    //    1770    211080    84
-            84,    //    1771    211208    84
-            84,    //    1772    211336    84
-            84,    //    1773    211464    84
-            84,    //    1774    211592    84
-            84,    //    1775    211720    84
-            84,    //    1776    211848    84
-            84,    //    1777    211976    84
-            84,    //    1778    212104    84
-            84,    //    1779    212232    84
-            84,    //    1780    212360    84
-            84,    //    1781    212488    84
-            84,    //    1782    212616    84
-            84,    //    1783    212744    84
-            84,    //    1784    212872    84
-            84,    //    1785    213000    84
-            84,    //    1786    213128    84
-            84,    //    1787    213256    84
-            84,    //    1788    213384    84
-            84,    //    1789    213512    84
-            84,    //    1790    213640    84
-            84,    //    1791    213768    84
-            84,    //    1792    213896    84
-            84,    //    1793    214024    84
-            84,    //    1794    214152    84
-            84,    //    1795    214280    84
-            84,    //    1796    214408    84
-            84,    //    1797    214536    84
-            84,    //    1798    214664    84
-            84,    //    1799    214792    84
-            84,    //    1800    214920    84
-            84,    //    1801    215048    84
-            84,    //    1802    215176    84
-            84,    //    1803    215304    84
-            84,    //    1804    215432    84
-            84,    //    1805    215560    84
-            84,    //    1806    215688    84
-            84,    //    1807    215816    84
-            84,    //    1808    215944    84
-            84,    //    1809    216072    84
-            84,    //    1810    216200    84
-            84,    //    1811    216328    84
-            84,    //    1812    216456    84
-            84,    //    1813    216584    84
-            84,    //    1814    216712    84
-            84,    //    1815    216840    84
-            84,    //    1816    216968    84
-            84,    //    1817    217096    84
-            84,    //    1818    217224    84
-            84,    //    1819    217352    84
-            84,    //    1820    217480    84
-            84,    //    1821    217608    84
-            84,    //    1822    217736    84
-            84,    //    1823    217864    84
-            84,    //    1824    217992    84
-            84,    //    1825    218120    84
-            84,    //    1826    218248    84
-            84,    //    1827    218376    84
-            84,    //    1828    218504    84
-            84,    //    1829    218632    84
-            84,    //    1830    218760    84
-            84,    //    1831    218888    84
-            84,    //    1832    219016    84
-            84,    //    1833    219144    84
-            84,    //    1834    219272    84
-            84,    //    1835    219400    84
-            84,    //    1836    219528    84
-            84,    //    1837    219656    84
-            84,    //    1838    219784    84
-            84,    //    1839    219912    84
-            84,    //    1840    220040    84
-            84,    //    1841    220168    84
-            84,    //    1842    220296    84
-            84,    //    1843    220424    84
-            84,    //    1844    220552    84
-            84,    //    1845    220680    84
-            84,    //    1846    220808    84
-            84,    //    1847    220936    84
-            84,    //    1848    221064    84
-            84,    //    1849    221192    84
-            84,    //    1850    221320    84
-            84,    //    1851    221448    84
-            84,    //    1852    221576    84
-            84,    //    1853    221704    84
-            84,    //    1854    221832    84
-            84,    //    1855    221960    84
-            84,    //    1856    222088    84
-            84,    //    1857    222216    84
-            84,    //    1858    222344    84
-            84,    //    1859    222472    84
-            84,    //    1860    222600    84
-            84,    //    1861    222728    84
-            84,    //    1862    222856    84
-            84,    //    1863    222984    84
-            84,    //    1864    223112    84
-            84,    //    1865    223240    84
-            84,    //    1866    223368    84
-            84,    //    1867    223496    84
-            84,    //    1868    223624    84
-            84,    //    1869    223752    84
-            84,    //    1870    223880    84
-            84,    //    1871    224008    84
-            84,    //    1872    224136    84
-            84,    //    1873    224264    84
-            84,    //    1874    224392    84
-            84,    //    1875    224520    84
-            84,    //    1876    224648    84
-            84,    //    1877    224776    84
-            84,    //    1878    224904    84
-            84,    //    1879    225032    84
-            84,    //    1880    225160    84
-            84,    //    1881    225288    84
-            84,    //    1882    225416    84
-            84,    //    1883    225544    84
-            84,    //    1884    225672    84
-            84,    //    1885    225800    84
-            84,    //    1886    225928    84
-            84,    //    1887    226056    84
-            84,    //    1888    226184    84
-            84,    //    1889    226312    84
-            84,    //    1890    226440    84
-            84,    //    1891    226568    84
-            84,    //    1892    226696    84
-            84,    //    1893    226824    84
-            84,    //    1894    226952    84
-            84,    //    1895    227080    84
-            84,    //    1896    227208    84
-            84,    //    1897    227336    84
-            84,    //    1898    227464    84
-            84,    //    1899    227592    84
-            84,    //    1900    227720    84
-            84,    //    1901    227848    84
-            84,    //    1902    227976    84
-            84,    //    1903    228104    84
-            84,    //    1904    228232    84
-            84,    //    1905    228360    84
-            84,    //    1906    228488    84
-            84,    //    1907    228616    84
-            84,    //    1908    228744    84
-            84,    //    1909    228872    84
-            84,    //    1910    229000    84
-            84,    //    1911    229128    84
-            84,    //    1912    229256    84
-            85,    //    1913    229384    85
-            85,    //    1914    229512    85
-            85,    //    1915    229640    85
-            85,    //    1916    229768    85
-            85,    //    1917    229896    85
-            85,    //    1918    230024    85
-            85,    //    1919    230152    85
-            85,    //    1920    230280    85
-            85,    //    1921    230408    85
-            85,    //    1922    230536    85
-            85,    //    1923    230664    85
-            85,    //    1924    230792    85
-            85,    //    1925    230920    85
-            85,    //    1926    231048    85
-            85,    //    1927    231176    85
-            85,    //    1928    231304    85
-            85,    //    1929    231432    85
-            85,    //    1930    231560    85
-            85,    //    1931    231688    85
-            85,    //    1932    231816    85
-            85,    //    1933    231944    85
-            85,    //    1934    232072    85
-            85,    //    1935    232200    85
-            85,    //    1936    232328    85
-            85,    //    1937    232456    85
-            85,    //    1938    232584    85
-            85,    //    1939    232712    85
-            85,    //    1940    232840    85
-            85,    //    1941    232968    85
-            85,    //    1942    233096    85
-            85,    //    1943    233224    85
-            85,    //    1944    233352    85
-            85,    //    1945    233480    85
-            85,    //    1946    233608    85
-            85,    //    1947    233736    85
-            85,    //    1948    233864    85
-            85,    //    1949    233992    85
-            85,    //    1950    234120    85
-            85,    //    1951    234248    85
-            85,    //    1952    234376    85
-            85,    //    1953    234504    85
-            85,    //    1954    234632    85
-            85,    //    1955    234760    85
-            85,    //    1956    234888    85
-            85,    //    1957    235016    85
-            85,    //    1958    235144    85
-            85,    //    1959    235272    85
-            85,    //    1960    235400    85
-            85,    //    1961    235528    85
-            85,    //    1962    235656    85
-            85,    //    1963    235784    85
-            85,    //    1964    235912    85
-            85,    //    1965    236040    85
-            85,    //    1966    236168    85
-            85,    //    1967    236296    85
-            85,    //    1968    236424    85
-            85,    //    1969    236552    85
-            85,    //    1970    236680    85
-            85,    //    1971    236808    85
-            85,    //    1972    236936    85
-            85,    //    1973    237064    85
-            85,    //    1974    237192    85
-            85,    //    1975    237320    85
-            85,    //    1976    237448    85
-            85,    //    1977    237576    85
-            85,    //    1978    237704    85
-            85,    //    1979    237832    85
-            85,    //    1980    237960    85
-            85,    //    1981    238088    85
-            85,    //    1982    238216    85
-            85,    //    1983    238344    85
-            85,    //    1984    238472    85
-            85,    //    1985    238600    85
-            85,    //    1986    238728    85
-            85,    //    1987    238856    85
-            85,    //    1988    238984    85
-            85,    //    1989    239112    85
-            85,    //    1990    239240    85
-            85,    //    1991    239368    85
-            85,    //    1992    239496    85
-            85,    //    1993    239624    85
-            85,    //    1994    239752    85
-            85,    //    1995    239880    85
-            85,    //    1996    240008    85
-            85,    //    1997    240136    85
-            85,    //    1998    240264    85
-            85,    //    1999    240392    85
-            85,    //    2000    240520    85
-            85,    //    2001    240648    85
-            85,    //    2002    240776    85
-            85,    //    2003    240904    85
-            85,    //    2004    241032    85
-            85,    //    2005    241160    85
-            85,    //    2006    241288    85
-            85,    //    2007    241416    85
-            85,    //    2008    241544    85
-            85,    //    2009    241672    85
-            85,    //    2010    241800    85
-            85,    //    2011    241928    85
-            85,    //    2012    242056    85
-            85,    //    2013    242184    85
-            85,    //    2014    242312    85
-            85,    //    2015    242440    85
-            85,    //    2016    242568    85
-            85,    //    2017    242696    85
-            85,    //    2018    242824    85
-            85,    //    2019    242952    85
-            85,    //    2020    243080    85
-            85,    //    2021    243208    85
-            85,    //    2022    243336    85
-            85,    //    2023    243464    85
-            85,    //    2024    243592    85
-            85,    //    2025    243720    85
-            85,    //    2026    243848    85
-            85,    //    2027    243976    85
-            85,    //    2028    244104    85
-            85,    //    2029    244232    85
-            85,    //    2030    244360    85
-            85,    //    2031    244488    85
-            85,    //    2032    244616    85
-            85,    //    2033    244744    85
-            85,    //    2034    244872    85
-            85,    //    2035    245000    85
-            85,    //    2036    245128    85
-            85,    //    2037    245256    85
-            85,    //    2038    245384    85
-            85,    //    2039    245512    85
-            85,    //    2040    245640    85
-            85,    //    2041    245768    85
-            85,    //    2042    245896    85
-            85,    //    2043    246024    85
-            85,    //    2044    246152    85
-            85,    //    2045    246280    85
-            85,    //    2046    246408    85
-            85,    //    2047    246536    85
-            85,    //    2048    246664    85
-            85,    //    2049    246792    85
-            85,    //    2050    246920    85
-            85,    //    2051    247048    85
-            85,    //    2052    247176    85
-            85,    //    2053    247304    85
-            85,    //    2054    247432    85
-            85,    //    2055    247560    85
-            85,    //    2056    247688    85
-            85,    //    2057    247816    85
-            85,    //    2058    247944    85
-            85,    //    2059    248072    85
-            85,    //    2060    248200    85
-            85,    //    2061    248328    85
-            85,    //    2062    248456    85
-            85,    //    2063    248584    85
-            85,    //    2064    248712    85
-            85,    //    2065    248840    85
-            85,    //    2066    248968    85
-            85,    //    2067    249096    85
-            85,    //    2068    249224    85
-            85,    //    2069    249352    85
-            85,    //    2070    249480    85
-            85,    //    2071    249608    85
-            85,    //    2072    249736    85
-            85,    //    2073    249864    85
-            85,    //    2074    249992    85
-            85,    //    2075    250120    85
-            85,    //    2076    250248    85
-            85,    //    2077    250376    85
-            85,    //    2078    250504    85
-            85,    //    2079    250632    85
-            85,    //    2080    250760    85
-            85,    //    2081    250888    85
-            85,    //    2082    251016    85
-            85,    //    2083    251144    85
-            85,    //    2084    251272    85
-            85,    //    2085    251400    85
-            85,    //    2086    251528    85
-            85,    //    2087    251656    85
-            85,    //    2088    251784    85
-            85,    //    2089    251912    85
-            85,    //    2090    252040    85
-            85,    //    2091    252168    85
-            85,    //    2092    252296    85
-            85,    //    2093    252424    85
-            85,    //    2094    252552    85
-            85,    //    2095    252680    85
-            85,    //    2096    252808    85
-            85,    //    2097    252936    85
-            85,    //    2098    253064    85
-            85,    //    2099    253192    85
-            85,    //    2100    253320    85
-            85,    //    2101    253448    85
-            85,    //    2102    253576    85
-            85,    //    2103    253704    85
-            85,    //    2104    253832    85
-            85,    //    2105    253960    85
-            85,    //    2106    254088    85
-            85,    //    2107    254216    85
-            85,    //    2108    254344    85
-            85,    //    2109    254472    85
-            85,    //    2110    254600    85
-            85,    //    2111    254728    85
-            85,    //    2112    254856    85
-            85,    //    2113    254984    85
-            85,    //    2114    255112    85
-            85,    //    2115    255240    85
-            85,    //    2116    255368    85
-            85,    //    2117    255496    85
-            85,    //    2118    255624    85
-            85,    //    2119    255752    85
-            85,    //    2120    255880    85
-            85,    //    2121    256008    85
-            85,    //    2122    256136    85
-            85,    //    2123    256264    85
-            85,    //    2124    256392    85
-            85,    //    2125    256520    85
-            85,    //    2126    256648    85
-            85,    //    2127    256776    85
-            85,    //    2128    256904    85
-            85,    //    2129    257032    85
-            85,    //    2130    257160    85
-            85,    //    2131    257288    85
-            85,    //    2132    257416    85
-            85,    //    2133    257544    85
-            85,    //    2134    257672    85
-            85,    //    2135    257800    85
-            85,    //    2136    257928    85
-            85,    //    2137    258056    85
-            85,    //    2138    258184    85
-            85,    //    2139    258312    85
-            85,    //    2140    258440    85
-            85,    //    2141    258568    85
-            85,    //    2142    258696    85
-            85,    //    2143    258824    85
-            85,    //    2144    258952    85
-            85,    //    2145    259080    85
-            85,    //    2146    259208    85
-            85,    //    2147    259336    85
-            85,    //    2148    259464    85
-            85,    //    2149    259592    85
-            85,    //    2150    259720    85
-            85,    //    2151    259848    85
-            85,    //    2152    259976    85
-            85,    //    2153    260104    85
-            85,    //    2154    260232    85
-            85,    //    2155    260360    85
-            85,    //    2156    260488    85
-            85,    //    2157    260616    85
-            85,    //    2158    260744    85
-            85,    //    2159    260872    85
-            85,    //    2160    261000    85
-            85,    //    2161    261128    85
-            85,    //    2162    261256    85
-            85,    //    2163    261384    85
-            85,    //    2164    261512    85
-            85,    //    2165    261640    85
-            85,    //    2166    261768    85
-            85,    //    2167    261896    85
-            85,    //    2168    262024    85
-    };
-
-    static bool SizeToClass(size_t size, int* cl) {
-        uint32_t idx;
-        if (ClassIndexMaybe(size, &idx)) {
-            *cl = IndexToClass[idx];
-            return true;
-        }
-        return false;
-    }
 }
 
 #endif //TCMALLOC_SIZE_CLASS_HPP
@@ -12,12 +12,17 @@
 
 namespace tcmalloc {
 
+// 记录尾指针，整个链表可以O(1)地接到另一个链表上，
+// 在ThreadCache、CentralFreelist和span之间搬运一批对象时不用逐个访问对象
 class FreeList {
 public:
-    FreeList() :head_(nullptr), free_count_(0) {}
+    constexpr FreeList() :free_count_(0), head_(nullptr), tail_(nullptr) {}
 
     void PushFront(void* ptr) {
         *(reinterpret_cast<void **>(ptr)) = head_;
+        if (head_ == nullptr) {
+            tail_ = ptr;
+        }
         head_ = ptr;
         free_count_++;
     }
@@ -27,15 +32,68 @@ public:
         void *result = head_;
         head_ = *(reinterpret_cast<void **>(result));
         free_count_--;
+        if (head_ == nullptr) {
+            tail_ = nullptr;
+        }
         return result;
     }
 
+    // 把head到tail共n个对象接到前面，只写tail的next
+    void PushRange(void* head, void* tail, uint64_t n) {
+        assert(n > 0);
+        *(reinterpret_cast<void **>(tail)) = head_;
+        if (head_ == nullptr) {
+            tail_ = tail;
+        }
+        head_ = head;
+        free_count_ += n;
+    }
+
+    // 把other整个接到前面，other变为空
+    void Splice(FreeList& other) {
+        if (other.Empty()) {
+            return;
+        }
+        PushRange(other.head_, other.tail_, other.free_count_);
+        other.Clear();
+    }
+
+    // 从前面取n个对象接到out前面。取走全部时是O(1)，
+    // 否则要读n-1个next指针找到这一段的尾部，但不写这些对象
+    void PopRange(uint64_t n, FreeList& out) {
+        assert(n <= free_count_);
+        if (n == 0) {
+            return;
+        }
+        if (n == free_count_) {
+            out.Splice(*this);
+            return;
+        }
+        void* head = head_;
+        void* tail = head_;
+        for (uint64_t i = 1; i < n; ++i) {
+            tail = *(reinterpret_cast<void **>(tail));
+        }
+        head_ = *(reinterpret_cast<void **>(tail));
+        free_count_ -= n;
+        out.PushRange(head, tail, n);
+    }
+
     int FreeObjects() {
         return free_count_;
     }
 
+    void* Head() {
+        return head_;
+    }
+
+    void* Tail() {
+        return tail_;
+    }
+
     void Clear() {
         head_ = nullptr;
+        tail_ = nullptr;
         free_count_ = 0;
     }
 
@@ -46,33 +104,109 @@ public:
 private:
     uint64_t free_count_;
     void* head_;
+    void* tail_;
 };
 
 struct Span {
-    Span* prev;
-    Span* next;
+    Span* prev = nullptr;
+    Span* next = nullptr;
 
-    uint64_t     page_id;
-    uint64_t     npages;
-    uint64_t     size_class;
-    uint64_t     refcount;
+    uint64_t     page_id = 0;
+    uint64_t     npages = 0;
+    uint64_t     size_class = 0;
+    uint64_t     refcount = 0;
     FreeList     freelist;
 
     static const uint64_t spanPageSize = 8 * 1024;
     enum Location { IN_USE, IN_NORMAL, IN_RETURNED };
-    uint64_t     location;
+    uint64_t     location = IN_USE;
+    // span的内存确定全为0：刚从系统mmap或者已经归还给系统
+    bool         zeroed = false;
+    // 最近从这个span取对象的线程，见RemoteFree。不在锁下读，用__atomic访问
+    int32_t      owner = -1;
 
-    uint64_t InitFreeList(uint64_t obj_bytes) {
+    // 对象数不超过64时用free_bitmap记录空闲对象，第i位对应第i个对象，
+    // 初始化和释放都只写span本身，不访问对象的内存；
+    // 否则用穿过对象的freelist记录还回来的对象，从没分配过的对象
+    // 从carve_ptr开始按需切出来，初始化不遍历整个span
+    static const uint64_t kMaxBitmapObjects = 64;
+    bool         use_bitmap = false;
+    uint32_t     obj_bytes = 0;
+    uint64_t     free_bitmap = 0;
+    char*        carve_ptr = nullptr;
+    uint64_t     uncarved = 0;
+
+    uint64_t InitFreeList(uint64_t bytes) {
         assert(location == IN_USE);
+        obj_bytes = bytes;
+        uint64_t objects = (npages * spanPageSize) / bytes;
+        use_bitmap = objects <= kMaxBitmapObjects;
+        if (use_bitmap) {
+            free_bitmap = objects == 64 ? ~uint64_t(0) : (uint64_t(1) << objects) - 1;
+            return objects;
+        }
         freelist.Clear();
         assert(freelist.Empty());
-        uint64_t ptr = reinterpret_cast<uint64_t>(reinterpret_cast<char *>(page_id * spanPageSize));
-        uint64_t limit = ptr + (npages * spanPageSize);
-        while (ptr + obj_bytes <= limit) {
-            freelist.PushFront((void*)ptr);
-            ptr += obj_bytes;
+        carve_ptr = reinterpret_cast<char *>(page_id * spanPageSize);
+        uncarved = objects;
+        return objects;
+    }
+
+    uint64_t FreeObjects() {
+        if (use_bitmap) {
+            return __builtin_popcountll(free_bitmap);
+        }
+        return freelist.FreeObjects() + uncarved;
+    }
+
+    bool HasFreeObjects() {
+        return use_bitmap ? free_bitmap != 0 : (!freelist.Empty() || uncarved > 0);
+    }
+
+    // 取n个空闲对象接到out前面
+    void PopFreeObjects(uint64_t n, FreeList& out) {
+        if (!use_bitmap) {
+            assert(n <= FreeObjects());
+            // 先用还回来的对象，它们所在的页已经访问过；不够时再切新的
+            uint64_t reuse = n < freelist.FreeObjects() ? n : freelist.FreeObjects();
+            freelist.PopRange(reuse, out);
+            Carve(n - reuse, out);
+            return;
+        }
+        assert(n <= FreeObjects());
+        char* base = reinterpret_cast<char *>(page_id * spanPageSize);
+        for (uint64_t i = 0; i < n; ++i) {
+            int index = __builtin_ctzll(free_bitmap);
+            free_bitmap &= free_bitmap - 1;
+            out.PushFront(base + index * obj_bytes);
+        }
+    }
+
+    // 从carve_ptr切n个地址连续的对象，按地址顺序接到out前面
+    void Carve(uint64_t n, FreeList& out) {
+        assert(n <= uncarved);
+        if (n == 0) {
+            return;
+        }
+        char* head = carve_ptr;
+        char* tail = carve_ptr + (n - 1) * obj_bytes;
+        for (char* ptr = head; ptr != tail; ptr += obj_bytes) {
+            *(reinterpret_cast<void **>(ptr)) = ptr + obj_bytes;
+        }
+        out.PushRange(head, tail, n);
+        carve_ptr = tail + obj_bytes;
+        uncarved -= n;
+    }
+
+    void PushFreeObject(void* ptr) {
+        if (!use_bitmap) {
+            freelist.PushFront(ptr);
+            return;
         }
-        return freelist.FreeObjects();
+        uint64_t index = (reinterpret_cast<char *>(ptr) - reinterpret_cast<char *>(page_id * spanPageSize)) / obj_bytes;
+        assert(index < kMaxBitmapObjects);
+        assert(((free_bitmap >> index) & 1) == 0);
+        free_bitmap |= uint64_t(1) << index;
     }
 
     static uint64_t PageIdFromPtr(void* ptr) {
@@ -82,12 +216,11 @@ struct Span {
 
 static tcmalloc::FixedAllocator<Span> span_allocator;
 
+// 复用的Span内存可能是脏的，用placement new按成员初始值重新构造
 Span* NewSpan(uint64_t page_id, uint64_t npages) {
-    Span* span = span_allocator.Alloc();
-    memset(span, 0, sizeof(span));
+    Span* span = new (span_allocator.Alloc()) Span();
     span->page_id = page_id;
     span->npages = npages;
-    span->refcount = 0;
     return span;
 }
 
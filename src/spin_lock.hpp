@@ -0,0 +1,53 @@
+//
+// Created by jamsonzan on 2026/10/18.
+//
+
+#ifndef TCMALLOC_SPIN_LOCK_HPP
+#define TCMALLOC_SPIN_LOCK_HPP
+
+#include <atomic>
+#include <sched.h>
+
+namespace tcmalloc {
+
+// 只自旋不进内核的锁，用于临界区很短而且很少竞争的地方。
+// 满足BasicLockable，可以配合std::lock_guard使用
+class SpinLock {
+public:
+    constexpr SpinLock() : locked_(false) {}
+
+    void lock() {
+        int spins = 0;
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) {
+                // 持锁的线程可能被抢占了，自旋太久就让出cpu
+                if (++spins < kSpinsBeforeYield) {
+#if defined(__x86_64__) || defined(__i386__)
+                    __builtin_ia32_pause();
+#endif
+                } else {
+                    sched_yield();
+                }
+            }
+        }
+    }
+
+    bool try_lock() {
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    void unlock() {
+        locked_.store(false, std::memory_order_release);
+    }
+
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+private:
+    static const int kSpinsBeforeYield = 1000;
+    std::atomic<bool> locked_;
+};
+
+}
+
+#endif //TCMALLOC_SPIN_LOCK_HPP
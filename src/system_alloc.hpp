@@ -17,8 +17,36 @@ void *SystemAlloc(size_t len) {
                 -1, 0);
 }
 
+// 首地址按align对齐的len字节，align是系统页大小的倍数。
+// 多映射align字节，再把头尾多出来的部分unmap
+void *SystemAllocAligned(size_t len, size_t align) {
+    void* ptr = SystemAlloc(len + align);
+    if (ptr == MAP_FAILED) {
+        return ptr;
+    }
+    uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    uintptr_t aligned = (start + align - 1) & ~(align - 1);
+    if (aligned > start) {
+        munmap(ptr, aligned - start);
+    }
+    uintptr_t end = start + len + align;
+    if (end > aligned + len) {
+        munmap(reinterpret_cast<void *>(aligned + len), end - aligned - len);
+    }
+    return reinterpret_cast<void *>(aligned);
+}
+
+// 建议内核用透明大页映射这段内存，内核不支持时忽略
+void SystemHugePage(void *start, size_t n) {
+#ifdef MADV_HUGEPAGE
+    madvise(start, n, MADV_HUGEPAGE);
+#endif
+}
+
+// MADV_DONTNEED之后匿名私有映射再访问时读到的全是0，
+// PageHeap据此把归还过的span标记为zeroed
 bool SystemRelease(void *start, size_t n) {
-    int result = madvise(start, n, MADV_FREE);
+    int result = madvise(start, n, MADV_DONTNEED);
     return result != -1;
 }
 
@@ -1,36 +1,331 @@
+#include <cstring>
+
 #include "page_heap.hpp"
 #include "size_class.hpp"
 #include "span.hpp"
 #include "thread_cache.hpp"
+#include "cpu_cache.hpp"
+#include "background_thread.hpp"
+#include "remote_free.hpp"
 #include "tcmalloc.h"
 
 namespace tcmalloc {
 
+    // 所有class的大小都是8的倍数
+    static const size_t kMinAlign = 8;
+
+    static Span* SpanFromPtr(void* ptr) {
+        Span* span = PageHeap::Instance()->GetSpanFromPageId(Span::PageIdFromPtr(ptr));
+        assert(span != nullptr && span->location == Span::IN_USE);
+        return span;
+    }
+
+    // 小对象的前端：打开per-cpu缓存时走CpuCache，否则走ThreadCache
+    static void* AllocSmall(int cl) {
+        if (CpuCache::Enabled()) {
+            return CpuCache::Instance()->Alloc(cl);
+        }
+        ThreadCache* curr = ThreadCache::Current();
+        return curr->Alloc(ClassSize(cl), cl);
+    }
+
+    static void FreeSmall(void* ptr, int cl) {
+        if (CpuCache::Enabled()) {
+            CpuCache::Instance()->Free(ptr, cl);
+            return;
+        }
+        ThreadCache* curr = ThreadCache::Current();
+        curr->Free(ptr, cl);
+    }
+
+    // span的owner不是当前线程时压入owner的队列，见RemoteFree。
+    // 当前线程还没有ThreadCache时也算非owner
+    static bool FreeRemote(void* ptr, Span* span) {
+        if (!RemoteFree::Enabled() || CpuCache::Enabled()) {
+            return false;
+        }
+        int owner = __atomic_load_n(&span->owner, __ATOMIC_RELAXED);
+        if (owner < 0) {
+            return false;
+        }
+        ThreadCache* curr = ThreadCache::CurrentMaybe();
+        if (curr != nullptr && curr->RemoteOwner() == owner) {
+            return false;
+        }
+        return RemoteFree::Push(owner, span->size_class, ptr);
+    }
+
+    // size向上取整到页数。size接近SIZE_MAX时取整会回绕成很小的页数，返回false
+    static bool SizeToPages(size_t size, uint64_t* npages) {
+        if (size > SIZE_MAX - Span::spanPageSize) {
+            return false;
+        }
+        *npages = (size + Span::spanPageSize - 1) / Span::spanPageSize;
+        return true;
+    }
+
+    static Span* AllocLargeSpan(size_t size) {
+        uint64_t npages;
+        if (!SizeToPages(size, &npages)) {
+            return nullptr;
+        }
+        return PageHeap::Instance()->New(npages);
+    }
+
+    static void* AllocLarge(size_t size) {
+        Span* span = AllocLargeSpan(size);
+        if (span == nullptr) {
+            return nullptr;
+        }
+        return reinterpret_cast<void *>(span->page_id * Span::spanPageSize);
+    }
+
     void *malloc(size_t size) {
         int cl;
         if (SizeToClass(size, &cl)) {
-            ThreadCache* curr = ThreadCache::Current();
-            size_t alloc_size = ClassSize(cl);
-            return curr->Alloc(alloc_size, cl);
+            return AllocSmall(cl);
         }
-        uint64_t npages = (size + Span::spanPageSize - 1) / Span::spanPageSize;
-        Span* span = PageHeap::Instance()->New(npages);
-        return reinterpret_cast<void *>(span->page_id * Span::spanPageSize);
+        return AllocLarge(size);
     }
 
     void free(void* ptr) {
-        uint64_t page_id = (uint64_t)ptr / Span::spanPageSize;
-        Span* span = PageHeap::Instance()->GetSpanFromPageId(page_id);
-        assert(span != nullptr && span->location == Span::IN_USE);
+        if (ptr == nullptr) {
+            return;
+        }
+        Span* span = SpanFromPtr(ptr);
         if (span->size_class != 0 && span->size_class < kMaxClass) {
-            ThreadCache* curr = ThreadCache::Current();
-            curr->Free(ptr, span->size_class);
+            if (FreeRemote(ptr, span)) {
+                return;
+            }
+            FreeSmall(ptr, span->size_class);
             return;
         }
         assert(reinterpret_cast<void *>(span->page_id*Span::spanPageSize) == ptr);
         PageHeap::Instance()->Delete(span);
     }
 
+    void free_sized(void* ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        int cl;
+        if (SizeToClass(size, &cl)) {
+            assert(SpanFromPtr(ptr)->size_class == cl);
+            // 跨线程释放需要span的owner，只有打开时才查PageMap
+            if (RemoteFree::Enabled() && FreeRemote(ptr, SpanFromPtr(ptr))) {
+                return;
+            }
+            FreeSmall(ptr, cl);
+            return;
+        }
+        // 大对象释放时总要拿到span
+        free(ptr);
+    }
+
+    size_t malloc_batch(size_t size, size_t n, void** out) {
+        int cl;
+        if (SizeToClass(size, &cl)) {
+            if (CpuCache::Enabled()) {
+                for (size_t i = 0; i < n; ++i) {
+                    out[i] = CpuCache::Instance()->Alloc(cl);
+                    if (out[i] == nullptr) {
+                        return i;
+                    }
+                }
+                return n;
+            }
+            ThreadCache* curr = ThreadCache::Current();
+            return curr->AllocBatch(cl, n, out);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = AllocLarge(size);
+            if (out[i] == nullptr) {
+                return i;
+            }
+        }
+        return n;
+    }
+
+    void free_batch(void** ptrs, size_t n) {
+        size_t i = 0;
+        while (i < n) {
+            if (ptrs[i] == nullptr) {
+                i++;
+                continue;
+            }
+            Span* span = SpanFromPtr(ptrs[i]);
+            if (span->size_class == 0) {
+                free(ptrs[i]);
+                i++;
+                continue;
+            }
+            size_t j = i + 1;
+            while (j < n && ptrs[j] != nullptr &&
+                   Span::PageIdFromPtr(ptrs[j]) >= span->page_id &&
+                   Span::PageIdFromPtr(ptrs[j]) < span->page_id + span->npages) {
+                j++;
+            }
+            if (CpuCache::Enabled()) {
+                for (size_t k = i; k < j; ++k) {
+                    CpuCache::Instance()->Free(ptrs[k], span->size_class);
+                }
+            } else {
+                ThreadCache* curr = ThreadCache::Current();
+                curr->FreeBatch(span->size_class, ptrs + i, j - i);
+            }
+            i = j;
+        }
+    }
+
+    void *calloc(size_t n, size_t size) {
+        size_t total;
+        if (__builtin_mul_overflow(n, size, &total)) {
+            return nullptr;
+        }
+        int cl;
+        if (SizeToClass(total, &cl)) {
+            void* ptr = malloc(total);
+            if (ptr != nullptr) {
+                memset(ptr, 0, total);
+            }
+            return ptr;
+        }
+        // 刚mmap或者归还过系统的span已经是0，memset只会把页全部换入
+        Span* span = AllocLargeSpan(total);
+        if (span == nullptr) {
+            return nullptr;
+        }
+        void* ptr = reinterpret_cast<void *>(span->page_id * Span::spanPageSize);
+        if (!span->zeroed) {
+            memset(ptr, 0, total);
+        }
+        return ptr;
+    }
+
+    void *realloc(void* ptr, size_t size) {
+        if (ptr == nullptr) {
+            return malloc(size);
+        }
+        if (size == 0) {
+            free(ptr);
+            return nullptr;
+        }
+        // 小对象只有新旧大小落在同一个class时原地返回，这样ptr的class始终与当前大小一致。
+        // 大对象原地缩小，或者吞并紧邻的空闲span原地扩大，都不行时才拷贝
+        Span* span = SpanFromPtr(ptr);
+        int cl;
+        if (span->size_class != 0) {
+            if (SizeToClass(size, &cl) && cl == span->size_class) {
+                return ptr;
+            }
+        } else if (size > kMaxSize) {
+            uint64_t npages;
+            if (!SizeToPages(size, &npages)) {
+                return nullptr;
+            }
+            if (PageHeap::Instance()->Resize(span, npages)) {
+                return ptr;
+            }
+        }
+        void* new_ptr = malloc(size);
+        if (new_ptr == nullptr) {
+            return nullptr;
+        }
+        size_t old_size = usable_size(ptr);
+        memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+        free(ptr);
+        return new_ptr;
+    }
+
+    void *memalign(size_t align, size_t size) {
+        if (align == 0 || (align & (align - 1)) != 0) {
+            return nullptr;
+        }
+        if (align <= kMinAlign) {
+            return malloc(size);
+        }
+        // 不超过一页的对齐从大小是align倍数的class分配
+        int cl;
+        if (align <= Span::spanPageSize && AlignedSizeToClass(size, align, &cl)) {
+            return AllocSmall(cl);
+        }
+        uint64_t npages;
+        if (!SizeToPages(size, &npages)) {
+            return nullptr;
+        }
+        uint64_t align_pages = (align + Span::spanPageSize - 1) / Span::spanPageSize;
+        Span* span = PageHeap::Instance()->NewAligned(npages == 0 ? 1 : npages, align_pages);
+        if (span == nullptr) {
+            return nullptr;
+        }
+        return reinterpret_cast<void *>(span->page_id * Span::spanPageSize);
+    }
+
+    void free_aligned_sized(void* ptr, size_t align, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (align <= kMinAlign) {
+            free_sized(ptr, size);
+            return;
+        }
+        int cl;
+        if (align <= Span::spanPageSize && AlignedSizeToClass(size, align, &cl)) {
+            assert(SpanFromPtr(ptr)->size_class == cl);
+            if (RemoteFree::Enabled() && FreeRemote(ptr, SpanFromPtr(ptr))) {
+                return;
+            }
+            FreeSmall(ptr, cl);
+            return;
+        }
+        free(ptr);
+    }
+
+    size_t usable_size(void* ptr) {
+        if (ptr == nullptr) {
+            return 0;
+        }
+        Span* span = SpanFromPtr(ptr);
+        if (span->size_class != 0) {
+            return ClassSize(span->size_class);
+        }
+        return span->npages * Span::spanPageSize;
+    }
+
+    size_t good_size(size_t size) {
+        int cl;
+        if (SizeToClass(size, &cl)) {
+            return ClassSize(cl);
+        }
+        uint64_t npages;
+        if (!SizeToPages(size, &npages)) {
+            return size;
+        }
+        return npages * Span::spanPageSize;
+    }
+
+    void *malloc_with_capacity(size_t size, size_t* capacity) {
+        int cl;
+        if (SizeToClass(size, &cl)) {
+            *capacity = ClassSize(cl);
+            return AllocSmall(cl);
+        }
+        Span* span = AllocLargeSpan(size);
+        if (span == nullptr) {
+            *capacity = 0;
+            return nullptr;
+        }
+        *capacity = span->npages * Span::spanPageSize;
+        return reinterpret_cast<void *>(span->page_id * Span::spanPageSize);
+    }
+
+    void* internal::AllocSlow(int cl, size_t size, size_t align) {
+        if (cl == 0) {
+            return memalign(align, size);
+        }
+        return AllocSmall(cl);
+    }
+
     void clear_current_cache() {
         ThreadCache* curr = ThreadCache::CurrentMaybe();
         if (curr != nullptr) {
@@ -50,4 +345,28 @@ namespace tcmalloc {
         ThreadCache::SetOverAllThreadCacheSize(new_size);
     }
 
+    void set_per_cpu_caches(bool enabled) {
+        CpuCache::SetEnabled(enabled);
+    }
+
+    size_t per_cpu_caches_used_size() {
+        return CpuCache::Instance()->UsedSize();
+    }
+
+    void set_remote_free(bool enabled) {
+        RemoteFree::SetEnabled(enabled);
+    }
+
+    void set_hugepage_aware(bool enabled) {
+        PageHeap::Instance()->SetHugePageAware(enabled);
+    }
+
+    bool start_background_thread(uint64_t interval_ms) {
+        return BackgroundThread::Instance().Start(interval_ms);
+    }
+
+    void stop_background_thread() {
+        BackgroundThread::Instance().Stop();
+    }
+
 }
@@ -5,71 +5,211 @@
 #ifndef TCMALLOC_THREAD_CACHE_HPP
 #define TCMALLOC_THREAD_CACHE_HPP
 
+#include <atomic>
+#include <unistd.h>
+#include <sys/syscall.h>
+#if __has_include(<linux/membarrier.h>)
+#include <linux/membarrier.h>
+#endif
+
 #include "pthread.h"
 #include "size_class.hpp"
 #include "span.hpp"
 #include "central_freelist.hpp"
 #include "thread_cache_freelist.hpp"
+#include "remote_free.hpp"
 
 namespace tcmalloc {
 
 class ThreadCache {
 public:
     void Init() {
-        total_alloc_ = 0;
-        total_free_ = 0;
+        hot_.total_alloc = 0;
+        hot_.total_free = 0;
+        last_ops_ = 0;
+        scavenge_cursor_ = 0;
+        for (int i = 0; i < internal::kActiveWords; ++i) {
+            hot_.active[i] = 0;
+        }
+        hot_.scavenge_requested.store(false, std::memory_order_relaxed);
+        hot_.in_use.store(false, std::memory_order_relaxed);
+        hot_.parked.store(false, std::memory_order_relaxed);
+        hot_.handoff.store(false, std::memory_order_relaxed);
         prev = nullptr;
         next = nullptr;
 
-        size_ = 0;
-        max_size_ = 0;
+        hot_.size = 0;
+        hot_.max_size.store(0, std::memory_order_relaxed);
         IncreaseCacheLimitLocked();
-        if (max_size_ < 0) {
-            max_size_ = kMinThreadCacheSize;
-            unclaimed_cache_space -= kMinThreadCacheSize;
+        if (hot_.max_size.load(std::memory_order_relaxed) == 0) {
+            hot_.max_size.store(kMinThreadCacheSize, std::memory_order_relaxed);
+            unclaimed_cache_space.fetch_sub(kMinThreadCacheSize, std::memory_order_relaxed);
         }
         for (int cl = 0; cl < kMaxClass; ++cl) {
-            freelists_[cl].Init(cl, ClassSize(cl));
+            freelists_[cl].Init(cl, ClassSize(cl), &hot_.lists[cl]);
         }
     }
 
     void* Alloc(size_t size, uint64_t cl) {
         assert(0 < cl && cl < kMaxClass);
+        OwnerScope scope(this);
+        if (hot_.scavenge_requested.load(std::memory_order_relaxed)) {
+            ReleaseIdleObjects();
+        }
+        // 命中时只访问hot_，freelists_[cl]只在慢路径使用
         void* rv;
-        if (!freelists_[cl].TryPop(&rv)) {
+        if (!hot_.lists[cl].TryPop(&rv)) {
             FetchFromCentralCache(freelists_[cl]);
-            freelists_[cl].TryPop(&rv);
+            // oom
+            if (!hot_.lists[cl].TryPop(&rv)) {
+                return nullptr;
+            }
         }
         size = ClassSize(cl);
-        size_ -= size;
-        total_alloc_ += size;
+        hot_.size -= size;
+        hot_.total_alloc += size;
         return rv;
     }
 
     void Free(void* ptr, uint64_t cl) {
         assert(0 < cl && cl < kMaxClass);
-        size_ += freelists_[cl].object_bytes();
-        total_free_ += ClassSize(cl);
-        int length = freelists_[cl].Push(ptr);
-        if (length > freelists_[cl].max_length()) {
+        OwnerScope scope(this);
+        if (hot_.scavenge_requested.load(std::memory_order_relaxed)) {
+            ReleaseIdleObjects();
+        }
+        internal::FreeListHead& list = hot_.lists[cl];
+        hot_.size += ClassSize(cl);
+        hot_.total_free += ClassSize(cl);
+        uint32_t length = list.Push(ptr);
+        if (length == 1) {
+            MarkActive(cl);
+            freelists_[cl].set_tail(ptr);
+        }
+        if (length > list.max_length) {
             ListTooLong(freelists_[cl]);
             return;
         }
-        if (size_ > max_size_){
+        if (hot_.size > hot_.max_size.load(std::memory_order_relaxed)){
+            Scavenge();
+        }
+    }
+
+    // 批量分配n个cl的对象到out，先取本线程freelist中已有的对象，
+    // 不够的部分按需要的数量从CentralFreelist取，不经过本线程freelist。
+    // 每次最多取kMaxBatchFetch个，内存不足时返回已经分配的个数
+    size_t AllocBatch(uint64_t cl, size_t n, void** out) {
+        assert(0 < cl && cl < kMaxClass);
+        OwnerScope scope(this);
+        ThreadCacheFreeList& fl = freelists_[cl];
+        size_t got = 0;
+        while (got < n && fl.TryPop(&out[got])) {
+            got++;
+        }
+        hot_.size -= fl.object_bytes() * got;
+        while (got < n) {
+            size_t want = std::min<size_t>(n - got, size_t(kMaxBatchFetch));
+            FreeList central_fl;
+            size_t fetched = central_freelists[cl].FillFreeList(central_fl, want);
+            assert(fetched <= want);
+            while (!central_fl.Empty()) {
+                out[got++] = central_fl.PopFront();
+            }
+            if (fetched < want) {
+                break;
+            }
+        }
+        hot_.total_alloc += ClassSize(cl) * got;
+        return got;
+    }
+
+    // 批量释放n个cl的对象，本线程freelist放到max_length为止，
+    // 其余的按batch_size直接还给CentralFreelist
+    void FreeBatch(uint64_t cl, void** ptrs, size_t n) {
+        assert(0 < cl && cl < kMaxClass);
+        OwnerScope scope(this);
+        ThreadCacheFreeList& fl = freelists_[cl];
+        size_t keep = 0;
+        if (fl.max_length() > fl.length()) {
+            keep = std::min<size_t>(n, fl.max_length() - fl.length());
+        }
+        for (size_t i = 0; i < keep; ++i) {
+            fl.Push(ptrs[i]);
+        }
+        if (keep > 0) {
+            MarkActive(cl);
+        }
+        hot_.size += fl.object_bytes() * keep;
+        hot_.total_free += ClassSize(cl) * n;
+
+        size_t batch_size = central_freelists[cl].BatchSize();
+        for (size_t i = keep; i < n; i += batch_size) {
+            size_t N = std::min(batch_size, n - i);
+            FreeList central_fl;
+            for (size_t j = 0; j < N; ++j) {
+                central_fl.PushFront(ptrs[i + j]);
+            }
+            central_freelists[cl].ReleaseFreeList(central_fl, N);
+        }
+        if (hot_.size > hot_.max_size.load(std::memory_order_relaxed)) {
             Scavenge();
         }
     }
 
     void Clear() {
-        for (int cl = 0; cl < kMaxClass; ++cl) {
+        OwnerScope scope(this);
+        ClearObjects();
+    }
+
+    // 所属线程在OwnerScope内调用，或者后台线程在所属线程parked时调用
+    void ClearObjects() {
+        for (int cl = NextActiveClass(0); cl >= 0; cl = NextActiveClass(cl + 1)) {
             if (freelists_[cl].length() > 0) {
                 ReleaseToCentralCache(freelists_[cl], freelists_[cl].length());
             }
         }
+        for (int i = 0; i < internal::kActiveWords; ++i) {
+            hot_.active[i] = 0;
+        }
+    }
+
+    void MarkActive(int cl) {
+        hot_.active[cl >> 6] |= uint64_t(1) << (cl & 63);
+    }
+
+    void ClearActive(int cl) {
+        hot_.active[cl >> 6] &= ~(uint64_t(1) << (cl & 63));
+    }
+
+    bool IsActive(int cl) {
+        return (hot_.active[cl >> 6] >> (cl & 63)) & 1;
+    }
+
+    // 返回>=from的第一个置位的class，没有时返回-1
+    int NextActiveClass(int from) {
+        for (int i = from >> 6; i < internal::kActiveWords; ++i) {
+            uint64_t word = hot_.active[i];
+            if (i == (from >> 6)) {
+                word &= ~uint64_t(0) << (from & 63);
+            }
+            if (word != 0) {
+                return i * 64 + __builtin_ctzll(word);
+            }
+        }
+        return -1;
+    }
+
+    // 后台线程发现本线程整整一个周期没有分配释放，这期间所有链表的
+    // 低水位就是链表长度，全部还给CentralFreelist。
+    // 由后台线程在所属线程parked时调用，内核不支持membarrier时由线程自己在下一次Alloc/Free时调用
+    void ReleaseIdleObjects() {
+        hot_.scavenge_requested.store(false, std::memory_order_relaxed);
+        ReclaimAllRemoteFrees();
+        // 归还全部对象之后lowater也都是0了
+        ClearObjects();
     }
 
     void ListTooLong(ThreadCacheFreeList& fl) {
-        int batch_size = ClassToMove(fl.cl());
+        int batch_size = central_freelists[fl.cl()].BatchSize();
         ReleaseToCentralCache(fl, batch_size);
 
         // 慢启动阶段不管分配释放都增加max_length
@@ -101,20 +241,60 @@ public:
             }
         }
 
-        if (size_ > max_size_) {
+        if (hot_.size > hot_.max_size.load(std::memory_order_relaxed)) {
             Scavenge();
         }
     }
 
+    // 取走其他线程释放到本线程队列中的cl对象，返回取到的个数
+    int ReclaimRemoteFrees(ThreadCacheFreeList& fl) {
+        if (remote_owner_ < 0) {
+            return 0;
+        }
+        void* ptr = RemoteFree::TakeAll(remote_owner_, fl.cl());
+        int n = 0;
+        while (ptr != nullptr) {
+            void* next = *(reinterpret_cast<void **>(ptr));
+            fl.Push(ptr);
+            ptr = next;
+            n++;
+        }
+        if (n > 0) {
+            MarkActive(fl.cl());
+            RemoteFree::Consumed(remote_owner_, fl.object_bytes() * n);
+        }
+        hot_.size += fl.object_bytes() * n;
+        return n;
+    }
+
+    void ReclaimAllRemoteFrees() {
+        for (int cl = 1; cl < kMaxClass; ++cl) {
+            ReclaimRemoteFrees(freelists_[cl]);
+        }
+    }
+
     void FetchFromCentralCache(ThreadCacheFreeList& fl) {
         assert(fl.empty());
-        int batch_size = ClassToMove(fl.cl());
+        // 先用其他线程还回来的对象，不碰CentralFreelist的锁。
+        // 取到的对象超过max_length的部分由下一次Free的ListTooLong归还
+        if (ReclaimRemoteFrees(fl) > 0) {
+            return;
+        }
+        int batch_size = central_freelists[fl.cl()].BatchSize();
         int N = batch_size > fl.max_length()? fl.max_length() : batch_size;
+        // 释放多于分配时ListTooLong会把max_length减到0，这时也至少取一个
+        if (N < 1) {
+            N = 1;
+        }
         FreeList central_fl;
-        int fetched = central_freelists[fl.cl()].FillFreeList(central_fl, N);
-        assert(fetched == N);
+        int fetched = central_freelists[fl.cl()].FillFreeList(central_fl, N, remote_owner_);
+        assert(fetched <= N);
+        if (fetched == 0) {
+            return;
+        }
         fl.PushFreeList(fetched, central_fl);
-        size_ += fl.object_bytes() * fetched;
+        MarkActive(fl.cl());
+        hot_.size += fl.object_bytes() * fetched;
 
         // ThreadCacheFreeList填充了新的对象，说明比较活跃，增加max_length配额
         // 控制ThreadCacheFreeList的max_length慢启动，小于batch_size时+1，
@@ -141,8 +321,8 @@ public:
         if (N <= 0) {
             return;
         }
-        size_ -= fl.object_bytes() * N;
-        int batch_size = ClassToMove(fl.cl());
+        hot_.size -= fl.object_bytes() * N;
+        int batch_size = central_freelists[fl.cl()].BatchSize();
         while (N > batch_size) {
             FreeList central_fl;
             fl.PopFreeList(batch_size, central_fl);
@@ -154,70 +334,129 @@ public:
         central_freelists[fl.cl()].ReleaseFreeList(central_fl, N);
     }
 
+    // 只处理活跃的class，而且每次最多kScavengeClassesPerCall个，
+    // 从上次停下的位置继续。size仍然超过max_size时下一次Free会接着处理，
+    // 使用的class很多时代价分摊到多次Free上，不会在一次Free里遍历全部class
     void Scavenge() {
-        for (int cl = 0; cl < kMaxClass; ++cl) {
-            ThreadCacheFreeList& fl = freelists_[cl];
-            int batch_size = ClassToMove(fl.cl());
-            if (fl.lowwatermark() > 0) {
-                int to_release = fl.lowwatermark()/2;
-                if (to_release < 1) {
-                    to_release = 1;
-                }
-                ReleaseToCentralCache(fl, to_release);
-                if (fl.max_length() > batch_size) {
-                    int new_max_length = fl.max_length() - batch_size;
-                    if (new_max_length < batch_size) {
-                        new_max_length = batch_size;
-                    }
-                    fl.set_max_length(new_max_length);
-                }
-            }
-            fl.clear_lowwatermark();
+        // 队列里的对象也算本线程的缓存，取出来和链表里的一起按低水位归还
+        if (remote_owner_ >= 0 && RemoteFree::QueuedBytes(remote_owner_) > 0) {
+            ReclaimAllRemoteFrees();
+        }
+        int budget = kScavengeClassesPerCall;
+        int next = ScavengeRange(scavenge_cursor_, kMaxClass, &budget);
+        if (budget > 0) {
+            next = ScavengeRange(0, scavenge_cursor_, &budget);
         }
+        scavenge_cursor_ = next;
 
         // 因为触发Scavenge的条件是size > max_size，尝试从请他线程窃取max_size
         IncreaseCacheLimit();
     }
 
+    // 处理[begin, end)中活跃的class直到budget用完，返回下一次开始的位置
+    int ScavengeRange(int begin, int end, int* budget) {
+        for (int cl = NextActiveClass(begin); cl >= 0 && cl < end; cl = NextActiveClass(cl + 1)) {
+            if (*budget == 0) {
+                return cl;
+            }
+            ScavengeClass(freelists_[cl]);
+            (*budget)--;
+        }
+        return end;
+    }
+
+    void ScavengeClass(ThreadCacheFreeList& fl) {
+        int batch_size = central_freelists[fl.cl()].BatchSize();
+        if (fl.lowwatermark() > 0) {
+            int to_release = fl.lowwatermark()/2;
+            if (to_release < 1) {
+                to_release = 1;
+            }
+            ReleaseToCentralCache(fl, to_release);
+            central_freelists[fl.cl()].RecordStranded(to_release);
+            if (fl.max_length() > batch_size) {
+                int new_max_length = fl.max_length() - batch_size;
+                if (new_max_length < batch_size) {
+                    new_max_length = batch_size;
+                }
+                fl.set_max_length(new_max_length);
+            }
+        }
+        fl.clear_lowwatermark();
+        if (fl.empty()) {
+            ClearActive(fl.cl());
+        }
+    }
+
+    // 领取未分配的空间只需要原子操作，不加锁。
+    // 窃取要遍历cache_list，只try_lock：拿不到锁说明其他线程正在窃取或者增删线程，
+    // 这次放弃，下次Scavenge再试，这样Scavenge的线程之间不会互相排队
     void IncreaseCacheLimit() {
-        global_lock.lock();
-        IncreaseCacheLimitLocked();
-        global_lock.unlock();
+        if (ClaimUnclaimedSpace()) {
+            return;
+        }
+        if (global_lock.try_lock()) {
+            StealCacheSpaceLocked();
+            global_lock.unlock();
+        }
     }
 
     void IncreaseCacheLimitLocked() {
-        if (unclaimed_cache_space > 0) {
-            unclaimed_cache_space -= kStealAmount;
-            max_size_ += kStealAmount;
+        if (ClaimUnclaimedSpace()) {
             return;
         }
-        // 从其他线程偷，只检查10个，防止加锁太久和无限循环
+        StealCacheSpaceLocked();
+    }
+
+    bool ClaimUnclaimedSpace() {
+        ssize_t space = unclaimed_cache_space.load(std::memory_order_relaxed);
+        while (space > 0) {
+            if (unclaimed_cache_space.compare_exchange_weak(space, space - kStealAmount,
+                                                            std::memory_order_relaxed)) {
+                hot_.max_size.fetch_add(kStealAmount, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void StealCacheSpaceLocked() {
+        // 从其他线程偷，只检查10个，防止加锁太久和无限循环。
+        // 被偷的线程自己也在无锁地修改hot_.max_size，用CAS减少它的配额
         int check = 10;
         while (check > 0 && next_cache_steal != nullptr) {
-            if (next_cache_steal != &cache_list &&
-                next_cache_steal != this && next_cache_steal->max_size_ > kMinThreadCacheSize) {
-                max_size_ += kStealAmount;
-                next_cache_steal->max_size_ -= kStealAmount;
-                next_cache_steal = next_cache_steal->next;
-                return;
+            ThreadCache* victim = next_cache_steal;
+            next_cache_steal = next_cache_steal->next;
+            if (victim != &cache_list && victim != this) {
+                uint64_t victim_size = victim->hot_.max_size.load(std::memory_order_relaxed);
+                while (victim_size > kMinThreadCacheSize) {
+                    if (victim->hot_.max_size.compare_exchange_weak(victim_size, victim_size - kStealAmount,
+                                                                std::memory_order_relaxed)) {
+                        hot_.max_size.fetch_add(kStealAmount, std::memory_order_relaxed);
+                        return;
+                    }
+                }
             }
             check--;
-            next_cache_steal = next_cache_steal->next;
         }
     }
 
-    // 当size_>=max_size_时执行Scavenge释放部分objects到centrallist
-    uint64_t size_;
-    uint64_t max_size_;
+    // 计数、配额和链表头，见internal::ThreadCacheHot
+    internal::ThreadCacheHot hot_;
     ThreadCacheFreeList freelists_[kMaxClass];
 
-    ThreadCache* prev;
-    ThreadCache* next;
-    uint64_t total_alloc_;
-    uint64_t total_free_;
-    uint64_t UsedSize() { return size_; }
-    uint64_t GetTotalAlloc() { return total_alloc_; }
-    uint64_t GetTotalFree() { return total_free_; }
+    ThreadCache* prev = nullptr;
+    ThreadCache* next = nullptr;
+    // 后台线程上一次看到的total_alloc+total_free，只在global_lock下读写
+    uint64_t last_ops_ = 0;
+    // 下一次Scavenge开始的class
+    int scavenge_cursor_ = 0;
+    // 接收其他线程释放对象的队列，见RemoteFree，-1表示没有
+    int remote_owner_ = -1;
+    int RemoteOwner() { return remote_owner_; }
+    uint64_t UsedSize() { return hot_.size; }
+    uint64_t GetTotalAlloc() { return hot_.total_alloc; }
+    uint64_t GetTotalFree() { return hot_.total_free; }
 
     static void GlobalInit() {
         assert(!global_inited);
@@ -230,6 +469,19 @@ public:
         global_inited = true;
     }
 
+    static void InitGlobalMaybe() {
+        global_lock.lock();
+        if (!global_inited) {
+            ThreadCache::GlobalInit();
+        }
+        global_lock.unlock();
+    }
+
+    static CentralFreelist& Central(int cl) {
+        assert(global_inited);
+        return central_freelists[cl];
+    }
+
     static ThreadCache* Current() {
         if (tls_cache != nullptr) return tls_cache;
 
@@ -240,9 +492,11 @@ public:
         assert(global_inited);
         ThreadCache* cache = thread_cache_allocator.Alloc();
         cache->Init();
+        cache->remote_owner_ = RemoteFree::AcquireOwner();
         // pthread_setspecific可能调用malloc递归回这个函数
         // 先设置tls_cache递归基，再调用pthread_setspecific
         tls_cache = cache;
+        internal::tls_hot = &cache->hot_;
         global_lock.unlock();
         pthread_setspecific(spec_key, cache);
 
@@ -268,12 +522,19 @@ public:
         // space是新计算的线程cache大小平均值，计算增长率ratio作为每个
         // 线程max_size的增长率，这样处理比直接设置绝对值更平滑。
         double ratio = space / per_thread_cache_size;
-        size_t claimed = 0;
+        // ClaimUnclaimedSpace不加锁，可能同时修改max_size和unclaimed_cache_space，
+        // 所以用CAS按最新值缩放，只把变化量记到unclaimed_cache_space，
+        // 保持所有线程的max_size之和加上unclaimed_cache_space等于overall_thread_cache_size
+        ssize_t delta = 0;
         for (ThreadCache* cache = cache_list.next; cache != &cache_list; cache = cache->next) {
-            cache->max_size_ = cache->max_size_ * ratio;
-            claimed += cache->max_size_;
+            uint64_t old_size = cache->hot_.max_size.load(std::memory_order_relaxed);
+            uint64_t new_size = old_size * ratio;
+            while (!cache->hot_.max_size.compare_exchange_weak(old_size, new_size, std::memory_order_relaxed)) {
+                new_size = old_size * ratio;
+            }
+            delta += ssize_t(new_size) - ssize_t(old_size);
         }
-        unclaimed_cache_space = overall_thread_cache_size - claimed;
+        unclaimed_cache_space.fetch_sub(delta, std::memory_order_relaxed);
         per_thread_cache_size = space;
     }
 
@@ -281,30 +542,179 @@ public:
         global_lock.lock();
         if (new_size < kMinThreadCacheSize) new_size = kMinThreadCacheSize;
         if (new_size > (1<<30)) new_size = (1<<30);
+        unclaimed_cache_space.fetch_add(ssize_t(new_size) - ssize_t(overall_thread_cache_size),
+                                        std::memory_order_relaxed);
         overall_thread_cache_size = new_size;
         RecomputePerThreadCacheSizeLocked();
         global_lock.unlock();
     }
 
+    // 所有线程的max_size之和加上unclaimed_cache_space减去overall_thread_cache_size，
+    // 配额没有丢失或者重复计算时为0
+    static ssize_t CacheSpaceDrift() {
+        global_lock.lock();
+        ssize_t total = unclaimed_cache_space.load(std::memory_order_relaxed);
+        for (ThreadCache* cache = cache_list.next; cache != &cache_list; cache = cache->next) {
+            total += cache->hot_.max_size.load(std::memory_order_relaxed);
+        }
+        total -= overall_thread_cache_size;
+        global_lock.unlock();
+        return total;
+    }
+
+    // 后台线程周期性调用。两次调用之间total_alloc+total_free没有变化的线程
+    // 视为空闲，由后台线程直接把它缓存的对象还给CentralFreelist，
+    // 线程一直不再分配释放时缓存也能回收。
+    // 先给空闲线程设置parked，membarrier之后仍然不在操作链表的线程下一次操作
+    // 一定能看到parked，会在OwnerScope里等global_lock释放，所以这时可以安全地归还。
+    // 计数由所属线程无锁地修改，这里只做relaxed读，读到旧值最多晚一个周期回收。
+    // 第一次调用时才打开hot_handoff，这之前操作链表不设置in_use的线程可能还没有结束，
+    // 所以只代为归还已经确认过handoff的线程，其余的和内核不支持membarrier时一样，
+    // 设置scavenge_requested由线程自己回收
+    static void ReleaseIdleCaches() {
+        global_lock.lock();
+        if (!global_inited) {
+            global_lock.unlock();
+            return;
+        }
+        bool fence = HeavyFenceSupported();
+        if (fence && !internal::HandoffEnabled()) {
+            internal::hot_handoff.store(true, std::memory_order_relaxed);
+        }
+        int parked = 0;
+        for (ThreadCache* cache = cache_list.next; cache != &cache_list; cache = cache->next) {
+            uint64_t ops = __atomic_load_n(&cache->hot_.total_alloc, __ATOMIC_RELAXED) +
+                           __atomic_load_n(&cache->hot_.total_free, __ATOMIC_RELAXED);
+            bool cached = __atomic_load_n(&cache->hot_.size, __ATOMIC_RELAXED) > 0 ||
+                          (cache->remote_owner_ >= 0 && RemoteFree::QueuedBytes(cache->remote_owner_) > 0);
+            if (ops == cache->last_ops_ && cached) {
+                if (fence && cache->hot_.handoff.load(std::memory_order_relaxed)) {
+                    cache->hot_.parked.store(true, std::memory_order_relaxed);
+                    parked++;
+                } else {
+                    cache->hot_.scavenge_requested.store(true, std::memory_order_relaxed);
+                }
+            }
+            cache->last_ops_ = ops;
+        }
+        if (parked > 0) {
+            HeavyFence();
+            for (ThreadCache* cache = cache_list.next; cache != &cache_list; cache = cache->next) {
+                if (!cache->hot_.parked.load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                if (!cache->hot_.in_use.load(std::memory_order_acquire)) {
+                    cache->ReleaseIdleObjects();
+                }
+                cache->hot_.parked.store(false, std::memory_order_release);
+            }
+        }
+        global_lock.unlock();
+    }
+
+    // 后台线程周期性调用，把空闲了一个周期的span还给PageHeap，见CentralFreelist::ReleaseIdleSpans
+    static void ReleaseIdleCentralSpans() {
+        global_lock.lock();
+        bool inited = global_inited;
+        global_lock.unlock();
+        if (!inited) {
+            return;
+        }
+        for (int cl = 1; cl < kMaxClass; ++cl) {
+            central_freelists[cl].ReleaseIdleSpans();
+        }
+    }
+
+    // 后台线程调用，提前给快取空的CentralFreelist补充span
+    static void RefillCentralFreelists() {
+        global_lock.lock();
+        bool inited = global_inited;
+        global_lock.unlock();
+        if (!inited) {
+            return;
+        }
+        for (int cl = 1; cl < kMaxClass; ++cl) {
+            central_freelists[cl].RefillIfLow();
+        }
+    }
+
     static void DestroyThreadCache(void *ptr) {
         ThreadCache* cache = static_cast<ThreadCache *>(ptr);
         DeleteCache(cache);
     }
 
     static void DeleteCache(ThreadCache* cache) {
-        cache->Clear();
+        {
+            OwnerScope scope(cache);
+            if (cache->remote_owner_ >= 0) {
+                RemoteFree::RetireOwner(cache->remote_owner_);
+                cache->ReclaimAllRemoteFrees();
+            }
+            cache->ClearObjects();
+        }
         tls_cache = nullptr;
+        internal::tls_hot = nullptr;
         global_lock.lock();
         if (next_cache_steal == cache) {
             next_cache_steal = cache->next;
         }
         CacheListRemove(cache);
-        unclaimed_cache_space += cache->max_size_;
+        if (cache->remote_owner_ >= 0) {
+            RemoteFree::ReleaseOwner(cache->remote_owner_);
+            cache->remote_owner_ = -1;
+        }
+        unclaimed_cache_space.fetch_add(cache->hot_.max_size.load(std::memory_order_relaxed),
+                                        std::memory_order_relaxed);
         thread_cache_allocator.Free(cache);
         global_lock.unlock();
     }
 
 private:
+    // 所属线程操作自己的链表期间持有，后台线程正在代为归还时等它结束。
+    // 后台线程没有开始代为归还之前什么也不做
+    class OwnerScope {
+    public:
+        explicit OwnerScope(ThreadCache* cache)
+                : hot_(internal::HandoffEnabled() ? &cache->hot_ : nullptr) {
+            if (hot_ == nullptr) {
+                return;
+            }
+            while (!internal::EnterHot(hot_)) {
+                // 后台线程在global_lock下归还，清除parked之后才释放锁
+                global_lock.lock();
+                global_lock.unlock();
+            }
+        }
+
+        ~OwnerScope() {
+            if (hot_ != nullptr) {
+                internal::LeaveHot(hot_);
+            }
+        }
+
+    private:
+        internal::ThreadCacheHot* hot_;
+    };
+
+    // 后台线程第一次调用时注册，只在global_lock下调用
+    static bool HeavyFenceSupported() {
+#if __has_include(<linux/membarrier.h>)
+        if (heavy_fence_state < 0) {
+            heavy_fence_state = syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0 ? 1 : 0;
+        }
+        return heavy_fence_state == 1;
+#else
+        return false;
+#endif
+    }
+
+    // 让进程内所有正在运行的线程执行一次内存屏障
+    static void HeavyFence() {
+#if __has_include(<linux/membarrier.h>)
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+#endif
+    }
+
     static const size_t kMinThreadCacheSize = kMaxSize * 2;
     static const size_t kMaxThreadCacheSize = 4 << 20;
 
@@ -316,11 +726,17 @@ private:
     static const size_t kStealAmount = 1 << 16;
 
     static const int kMaxOverages = 3;
+    static const int kScavengeClassesPerCall = 16;
+    // AllocBatch一次从CentralFreelist取的上限，FetchFromSpans按int计数
+    static const size_t kMaxBatchFetch = 1 << 16;
     static const int kMaxDynamicFreeListLength = 8192;
+    static_assert(kMaxDynamicFreeListLength <= UINT16_MAX, "max_length is stored in 16 bits");
 
     static size_t overall_thread_cache_size;
     static size_t per_thread_cache_size;
-    static ssize_t unclaimed_cache_space;
+    static std::atomic<ssize_t> unclaimed_cache_space;
+    // -1未检查，0内核不支持membarrier，1已注册
+    static int heavy_fence_state;
 
 
     static __thread ThreadCache* tls_cache;
@@ -370,9 +786,12 @@ ThreadCache ThreadCache::cache_list;
 ThreadCache* ThreadCache::next_cache_steal = nullptr;
 size_t ThreadCache::overall_thread_cache_size = kDefaultOverallThreadCacheSize;
 size_t ThreadCache::per_thread_cache_size = kMaxThreadCacheSize;
-ssize_t ThreadCache::unclaimed_cache_space = kDefaultOverallThreadCacheSize;
+std::atomic<ssize_t> ThreadCache::unclaimed_cache_space(kDefaultOverallThreadCacheSize);
+int ThreadCache::heavy_fence_state = -1;
 FixedAllocator<ThreadCache> ThreadCache::thread_cache_allocator;
-__thread ThreadCache* ThreadCache::tls_cache = nullptr;
+__thread ThreadCache* ThreadCache::tls_cache __attribute__((tls_model("initial-exec"))) = nullptr;
+__thread internal::ThreadCacheHot* internal::tls_hot = nullptr;
+std::atomic<bool> internal::hot_handoff(false);
 
 
 }
@@ -8,31 +8,39 @@
 #include <cstdint>
 
 #include "span.hpp"
+#include "tcmalloc.h"
 
 namespace tcmalloc {
 
+    // 链表头、长度、低水位和max_length放在ThreadCache的热数据internal::ThreadCacheHot中，
+    // tcmalloc.h中内联的分配路径会直接操作它们，这里只保存慢路径用的字段
     class ThreadCacheFreeList {
     private:
-        FreeList list_;
-        uint32_t lowater_;
-        uint32_t max_length_;
-        uint32_t length_overages_;
-        uint64_t obj_bytes_;
+        internal::FreeListHead* list_ = nullptr;
+        // 链表最底下的对象，length>0时有效。分配只从链表头取，
+        // 只有链表从空变为非空时它才会变，这些路径都不内联，由慢路径维护
+        void* tail_ = nullptr;
+        uint32_t length_overages_ = 0;
+        uint32_t obj_bytes_ = 0;
 
-        int cl_;
+        int cl_ = 0;
 
     public:
-        void Init(int cl, size_t size) {
+        void Init(int cl, size_t size, internal::FreeListHead* list) {
             assert(cl < kMaxClass);
-            lowater_ = 0;
-            max_length_ = 1;
+            list_ = list;
+            list_->head = nullptr;
+            list_->length = 0;
+            list_->lowater = 0;
+            list_->max_length = 1;
+            tail_ = nullptr;
             length_overages_ = 0;
             obj_bytes_ = size;
             cl_ = cl;
         }
 
         size_t length() {
-            return list_.FreeObjects();
+            return list_->length;
         }
 
         int32_t object_bytes() const {
@@ -44,10 +52,11 @@ namespace tcmalloc {
         }
 
         size_t max_length() const {
-            return max_length_;
+            return list_->max_length;
         }
         void set_max_length(size_t new_max) {
-            max_length_ = new_max;
+            assert(new_max <= UINT16_MAX);
+            list_->max_length = new_max;
         }
 
         size_t length_overages() const {
@@ -58,47 +67,76 @@ namespace tcmalloc {
         }
 
         bool empty() {
-            return list_.Empty();
+            return list_->length == 0;
         }
 
-        int lowwatermark() const { return lowater_; }
-        void clear_lowwatermark() { lowater_ = list_.FreeObjects(); }
+        int lowwatermark() const { return list_->lowater; }
+        void clear_lowwatermark() {
+            list_->lowater = list_->length < UINT16_MAX ? list_->length : UINT16_MAX;
+        }
 
         int Push(void* ptr) {
-            list_.PushFront(ptr);
-            return list_.FreeObjects();
+            int length = list_->Push(ptr);
+            if (length == 1) {
+                tail_ = ptr;
+            }
+            return length;
+        }
+
+        // ThreadCache::Free直接压入链表头，链表从空变为非空时调用
+        void set_tail(void* ptr) {
+            tail_ = ptr;
         }
 
         void* Pop() {
-            assert(!list_.Empty());
-            void* ptr = list_.PopFront();
-            if (list_.FreeObjects() < lowater_) lowater_ = list_.FreeObjects();
+            assert(!empty());
+            void* ptr;
+            list_->TryPop(&ptr);
             return ptr;
         }
 
         bool TryPop(void **rv) {
-            if (!list_.Empty()) {
-                *rv = list_.PopFront();
-                if (list_.FreeObjects() < lowater_) lowater_ = list_.FreeObjects();
-                return true;
-            }
-            return false;
+            return list_->TryPop(rv);
         }
 
+        // 整个fl接到链表前面，只写fl尾部对象的next
         void PushFreeList(int N, FreeList& fl) {
-            while (!fl.Empty()) {
-                list_.PushFront(fl.PopFront());
+            assert(fl.FreeObjects() == N);
+            if (N == 0) {
+                return;
+            }
+            if (list_->length == 0) {
+                tail_ = fl.Tail();
             }
+            *(reinterpret_cast<void **>(fl.Tail())) = list_->head;
+            list_->head = fl.Head();
+            list_->length += N;
+            fl.Clear();
         }
 
+        // 取前N个对象接到fl前面。取走全部时用tail_，是O(1)的；
+        // 只取一部分时没有这一段的边界，要读N-1个next找到尾部，但不写这些对象
         void PopFreeList(int N, FreeList& fl) {
-            assert(list_.FreeObjects() >= N);
-            int pop = 0;
-            while (pop < N) {
-                fl.PushFront(list_.PopFront());
-                pop++;
+            assert(list_->length >= N);
+            if (N == 0) {
+                return;
+            }
+            if (N == list_->length) {
+                fl.PushRange(list_->head, tail_, N);
+                list_->head = nullptr;
+                list_->length = 0;
+                list_->lowater = 0;
+                return;
+            }
+            void* head = list_->head;
+            void* tail = head;
+            for (int i = 1; i < N; ++i) {
+                tail = *(reinterpret_cast<void **>(tail));
             }
-            if (list_.FreeObjects() < lowater_) lowater_ = list_.FreeObjects();
+            list_->head = *(reinterpret_cast<void **>(tail));
+            list_->length -= N;
+            fl.PushRange(head, tail, N);
+            if (list_->length < list_->lowater) list_->lowater = list_->length;
         }
     };
 